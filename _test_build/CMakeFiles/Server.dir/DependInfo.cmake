@@ -0,0 +1,79 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/engine/server/databases/connection.cpp" "CMakeFiles/Server.dir/src/engine/server/databases/connection.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/databases/connection.cpp.o.d"
+  "/root/repo/src/engine/server/databases/connection_pool.cpp" "CMakeFiles/Server.dir/src/engine/server/databases/connection_pool.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/databases/connection_pool.cpp.o.d"
+  "/root/repo/src/engine/server/databases/mysql.cpp" "CMakeFiles/Server.dir/src/engine/server/databases/mysql.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "/root/repo/src/engine/server/databases/sqlite.cpp" "CMakeFiles/Server.dir/src/engine/server/databases/sqlite.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "/root/repo/src/engine/server/mapconverter.cpp" "CMakeFiles/Server.dir/src/engine/server/mapconverter.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/mapconverter.cpp.o.d"
+  "/root/repo/src/engine/server/name_ban.cpp" "CMakeFiles/Server.dir/src/engine/server/name_ban.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/name_ban.cpp.o.d"
+  "/root/repo/src/engine/server/register.cpp" "CMakeFiles/Server.dir/src/engine/server/register.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/register.cpp.o.d"
+  "/root/repo/src/engine/server/roundstatistics.cpp" "CMakeFiles/Server.dir/src/engine/server/roundstatistics.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/roundstatistics.cpp.o.d"
+  "/root/repo/src/engine/server/server.cpp" "CMakeFiles/Server.dir/src/engine/server/server.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/server.cpp.o.d"
+  "/root/repo/src/engine/server/server_logger.cpp" "CMakeFiles/Server.dir/src/engine/server/server_logger.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/server_logger.cpp.o.d"
+  "/root/repo/src/engine/server/sql_string_helpers.cpp" "CMakeFiles/Server.dir/src/engine/server/sql_string_helpers.cpp.o" "gcc" "CMakeFiles/Server.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "/root/repo/_test_build/src/game/generated/server_data.cpp" "CMakeFiles/Server.dir/src/game/generated/server_data.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/generated/server_data.cpp.o.d"
+  "/root/repo/src/game/server/alloc.cpp" "CMakeFiles/Server.dir/src/game/server/alloc.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/alloc.cpp.o.d"
+  "/root/repo/src/game/server/ddracecommands.cpp" "CMakeFiles/Server.dir/src/game/server/ddracecommands.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/ddracecommands.cpp.o.d"
+  "/root/repo/src/game/server/entities/character.cpp" "CMakeFiles/Server.dir/src/game/server/entities/character.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/entities/character.cpp.o.d"
+  "/root/repo/src/game/server/entities/projectile.cpp" "CMakeFiles/Server.dir/src/game/server/entities/projectile.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/entities/projectile.cpp.o.d"
+  "/root/repo/src/game/server/entity.cpp" "CMakeFiles/Server.dir/src/game/server/entity.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/entity.cpp.o.d"
+  "/root/repo/src/game/server/eventhandler.cpp" "CMakeFiles/Server.dir/src/game/server/eventhandler.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/eventhandler.cpp.o.d"
+  "/root/repo/src/game/server/gamecontext.cpp" "CMakeFiles/Server.dir/src/game/server/gamecontext.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/gamecontext.cpp.o.d"
+  "/root/repo/src/game/server/gamecontroller.cpp" "CMakeFiles/Server.dir/src/game/server/gamecontroller.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/gamecontroller.cpp.o.d"
+  "/root/repo/src/game/server/gameworld.cpp" "CMakeFiles/Server.dir/src/game/server/gameworld.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/gameworld.cpp.o.d"
+  "/root/repo/src/game/server/infclass/classes/humans/human.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/classes/humans/human.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/classes/humans/human.cpp.o.d"
+  "/root/repo/src/game/server/infclass/classes/infcplayerclass.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/classes/infcplayerclass.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/classes/infcplayerclass.cpp.o.d"
+  "/root/repo/src/game/server/infclass/classes/infected/infected.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/classes/infected/infected.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/classes/infected/infected.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/biologist-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/biologist-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/biologist-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/biologist-mine.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/biologist-mine.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/biologist-mine.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/blinding-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/blinding-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/blinding-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/bouncing-bullet.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/bouncing-bullet.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/bouncing-bullet.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/engineer-wall.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/engineer-wall.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/engineer-wall.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/flyingpoint.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/flyingpoint.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/flyingpoint.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/growingexplosion.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/growingexplosion.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/growingexplosion.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/hero-flag.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/hero-flag.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/hero-flag.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/ic-pickup.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/ic-pickup.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/ic-pickup.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/infc-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infc-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infc-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/infc-placed-object.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infc-placed-object.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infc-placed-object.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/infccharacter.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infccharacter.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infccharacter.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/infcentity.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infcentity.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/infcentity.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/laser-teleport.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/laser-teleport.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/laser-teleport.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/looper-wall.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/looper-wall.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/looper-wall.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/medic-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/medic-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/medic-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/merc-bomb.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/merc-bomb.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/merc-bomb.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/merc-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/merc-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/merc-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/plasma.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/plasma.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/plasma.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/scatter-grenade.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scatter-grenade.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scatter-grenade.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/scientist-laser.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scientist-laser.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scientist-laser.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/scientist-mine.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scientist-mine.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/scientist-mine.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/slug-slime.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/slug-slime.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/slug-slime.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/soldier-bomb.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/soldier-bomb.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/soldier-bomb.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/superweapon-indicator.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/superweapon-indicator.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/superweapon-indicator.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/turret.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/turret.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/turret.cpp.o.d"
+  "/root/repo/src/game/server/infclass/entities/white-hole.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/entities/white-hole.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/entities/white-hole.cpp.o.d"
+  "/root/repo/src/game/server/infclass/events-director.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/events-director.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/events-director.cpp.o.d"
+  "/root/repo/src/game/server/infclass/infcgamecontroller.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/infcgamecontroller.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/infcgamecontroller.cpp.o.d"
+  "/root/repo/src/game/server/infclass/infcplayer.cpp" "CMakeFiles/Server.dir/src/game/server/infclass/infcplayer.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/infclass/infcplayer.cpp.o.d"
+  "/root/repo/src/game/server/main_server.cpp" "CMakeFiles/Server.dir/src/game/server/main_server.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/main_server.cpp.o.d"
+  "/root/repo/src/game/server/player.cpp" "CMakeFiles/Server.dir/src/game/server/player.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/player.cpp.o.d"
+  "/root/repo/src/game/server/teams.cpp" "CMakeFiles/Server.dir/src/game/server/teams.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/teams.cpp.o.d"
+  "/root/repo/src/game/server/teeinfo.cpp" "CMakeFiles/Server.dir/src/game/server/teeinfo.cpp.o" "gcc" "CMakeFiles/Server.dir/src/game/server/teeinfo.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/engine-gfx.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/engine-shared.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/game-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
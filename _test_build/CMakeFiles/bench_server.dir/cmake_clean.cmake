@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/connection.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/connection.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/connection_pool.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/connection_pool.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/mysql.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/mysql.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/sqlite.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/databases/sqlite.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/mapconverter.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/mapconverter.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/name_ban.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/name_ban.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/register.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/register.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/roundstatistics.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/roundstatistics.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/server.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/server.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/server_logger.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/server_logger.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/engine/server/sql_string_helpers.cpp.o"
+  "CMakeFiles/bench_server.dir/src/engine/server/sql_string_helpers.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/generated/server_data.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/generated/server_data.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/alloc.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/alloc.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/ddracecommands.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/ddracecommands.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/entities/character.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/entities/character.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/entities/projectile.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/entities/projectile.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/entity.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/entity.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/eventhandler.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/eventhandler.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/gamecontext.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/gamecontext.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/gamecontroller.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/gamecontroller.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/gameworld.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/gameworld.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/humans/human.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/humans/human.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/infcplayerclass.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/infcplayerclass.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/infected/infected.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/classes/infected/infected.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/biologist-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/biologist-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/biologist-mine.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/biologist-mine.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/blinding-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/blinding-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/bouncing-bullet.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/bouncing-bullet.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/engineer-wall.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/engineer-wall.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/flyingpoint.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/flyingpoint.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/growingexplosion.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/growingexplosion.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/hero-flag.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/hero-flag.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/ic-pickup.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/ic-pickup.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infc-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infc-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infc-placed-object.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infc-placed-object.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infccharacter.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infccharacter.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infcentity.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/infcentity.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/laser-teleport.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/laser-teleport.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/looper-wall.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/looper-wall.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/medic-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/medic-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/merc-bomb.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/merc-bomb.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/merc-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/merc-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/plasma.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/plasma.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scatter-grenade.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scatter-grenade.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scientist-laser.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scientist-laser.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scientist-mine.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/scientist-mine.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/slug-slime.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/slug-slime.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/soldier-bomb.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/soldier-bomb.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/superweapon-indicator.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/superweapon-indicator.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/turret.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/turret.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/white-hole.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/entities/white-hole.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/events-director.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/events-director.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/infcgamecontroller.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/infcgamecontroller.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/infcplayer.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/infclass/infcplayer.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/player.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/player.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/teams.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/teams.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/game/server/teeinfo.cpp.o"
+  "CMakeFiles/bench_server.dir/src/game/server/teeinfo.cpp.o.d"
+  "CMakeFiles/bench_server.dir/src/tools/bench_server.cpp.o"
+  "CMakeFiles/bench_server.dir/src/tools/bench_server.cpp.o.d"
+  "bench_server"
+  "bench_server.pdb"
+  "src/game/generated/server_data.cpp"
+  "src/game/generated/server_data.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/bench_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
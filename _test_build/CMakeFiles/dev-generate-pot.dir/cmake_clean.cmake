@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dev-generate-pot"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dev-generate-pot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/dilate.cpp" "CMakeFiles/dilate.dir/src/tools/dilate.cpp.o" "gcc" "CMakeFiles/dilate.dir/src/tools/dilate.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_test_build/CMakeFiles/engine-gfx.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/engine-shared.dir/DependInfo.cmake"
+  "/root/repo/_test_build/CMakeFiles/game-shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dummy_map.dir/src/tools/dummy_map.cpp.o"
+  "CMakeFiles/dummy_map.dir/src/tools/dummy_map.cpp.o.d"
+  "dummy_map"
+  "dummy_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/dummy_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/game/animation.cpp" "CMakeFiles/game-shared.dir/src/game/animation.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/animation.cpp.o.d"
+  "/root/repo/src/game/collision.cpp" "CMakeFiles/game-shared.dir/src/game/collision.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/collision.cpp.o.d"
+  "/root/repo/src/game/gamecore.cpp" "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o.d"
+  "/root/repo/_test_build/src/game/generated/git_revision.cpp" "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o.d"
+  "/root/repo/src/game/infclass/classes.cpp" "CMakeFiles/game-shared.dir/src/game/infclass/classes.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/infclass/classes.cpp.o.d"
+  "/root/repo/src/game/infclass/damage_type.cpp" "CMakeFiles/game-shared.dir/src/game/infclass/damage_type.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/infclass/damage_type.cpp.o.d"
+  "/root/repo/src/game/infclass/events.cpp" "CMakeFiles/game-shared.dir/src/game/infclass/events.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/infclass/events.cpp.o.d"
+  "/root/repo/src/game/layers.cpp" "CMakeFiles/game-shared.dir/src/game/layers.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/layers.cpp.o.d"
+  "/root/repo/src/game/mapitems_ex.cpp" "CMakeFiles/game-shared.dir/src/game/mapitems_ex.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/mapitems_ex.cpp.o.d"
+  "/root/repo/src/game/teamscore.cpp" "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o.d"
+  "/root/repo/src/teeuniverses/components/localization.cpp" "CMakeFiles/game-shared.dir/src/teeuniverses/components/localization.cpp.o" "gcc" "CMakeFiles/game-shared.dir/src/teeuniverses/components/localization.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
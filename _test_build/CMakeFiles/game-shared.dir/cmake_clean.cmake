@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/game-shared.dir/src/game/animation.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/animation.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/collision.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/collision.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/gamecore.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/generated/git_revision.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/infclass/classes.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/infclass/classes.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/infclass/damage_type.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/infclass/damage_type.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/infclass/events.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/infclass/events.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/layers.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/layers.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/mapitems_ex.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/mapitems_ex.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o"
+  "CMakeFiles/game-shared.dir/src/game/teamscore.cpp.o.d"
+  "CMakeFiles/game-shared.dir/src/teeuniverses/components/localization.cpp.o"
+  "CMakeFiles/game-shared.dir/src/teeuniverses/components/localization.cpp.o.d"
+  "libgame-shared.a"
+  "libgame-shared.pdb"
+  "src/game/generated/git_revision.cpp"
+  "src/game/generated/protocol.h"
+  "src/game/generated/protocol7.h"
+  "src/game/generated/protocolglue.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/game-shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
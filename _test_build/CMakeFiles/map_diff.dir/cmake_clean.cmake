@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_diff.dir/src/tools/map_diff.cpp.o"
+  "CMakeFiles/map_diff.dir/src/tools/map_diff.cpp.o.d"
+  "map_diff"
+  "map_diff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_extract.dir/src/tools/map_extract.cpp.o"
+  "CMakeFiles/map_extract.dir/src/tools/map_extract.cpp.o.d"
+  "map_extract"
+  "map_extract.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_extract.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/map_resave.dir/src/tools/map_resave.cpp.o"
+  "CMakeFiles/map_resave.dir/src/tools/map_resave.cpp.o.d"
+  "map_resave"
+  "map_resave.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/map_resave.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
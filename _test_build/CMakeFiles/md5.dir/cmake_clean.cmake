@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/md5.dir/src/engine/external/md5/md5.c.o"
+  "CMakeFiles/md5.dir/src/engine/external/md5/md5.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/md5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/packetgen.dir/src/tools/packetgen.cpp.o"
+  "CMakeFiles/packetgen.dir/src/tools/packetgen.cpp.o.d"
+  "packetgen"
+  "packetgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/packetgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_collision.dir/src/tests/test_collision.cpp.o"
+  "CMakeFiles/test_collision.dir/src/tests/test_collision.cpp.o.d"
+  "test_collision"
+  "test_collision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test_collision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
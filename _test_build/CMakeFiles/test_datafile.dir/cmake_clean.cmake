@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_datafile.dir/src/tests/test_datafile.cpp.o"
+  "CMakeFiles/test_datafile.dir/src/tests/test_datafile.cpp.o.d"
+  "test_datafile"
+  "test_datafile.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test_datafile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_icArray.dir/src/tests/test_icArray.cpp.o"
+  "CMakeFiles/test_icArray.dir/src/tests/test_icArray.cpp.o.d"
+  "test_icArray"
+  "test_icArray.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test_icArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
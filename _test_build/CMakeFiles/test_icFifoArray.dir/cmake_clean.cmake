@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_icFifoArray.dir/src/tests/test_icFifoArray.cpp.o"
+  "CMakeFiles/test_icFifoArray.dir/src/tests/test_icFifoArray.cpp.o.d"
+  "test_icFifoArray"
+  "test_icFifoArray.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test_icFifoArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_localization.dir/src/tests/test_localization.cpp.o"
+  "CMakeFiles/test_localization.dir/src/tests/test_localization.cpp.o.d"
+  "test_localization"
+  "test_localization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/test_localization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
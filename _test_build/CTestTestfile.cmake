@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_test_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_collision]=] "/root/repo/_test_build/test_collision")
+set_tests_properties([=[test_collision]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1196;add_test;/root/repo/CMakeLists.txt;0;")
+add_test([=[test_datafile]=] "/root/repo/_test_build/test_datafile")
+set_tests_properties([=[test_datafile]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1196;add_test;/root/repo/CMakeLists.txt;0;")
+add_test([=[test_icArray]=] "/root/repo/_test_build/test_icArray")
+set_tests_properties([=[test_icArray]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1196;add_test;/root/repo/CMakeLists.txt;0;")
+add_test([=[test_icFifoArray]=] "/root/repo/_test_build/test_icFifoArray")
+set_tests_properties([=[test_icFifoArray]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1196;add_test;/root/repo/CMakeLists.txt;0;")
+add_test([=[test_localization]=] "/root/repo/_test_build/test_localization")
+set_tests_properties([=[test_localization]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1196;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1 @@
+const char *GIT_SHORTREV_HASH = "6bce63d45496";
@@ -0,0 +1,13 @@
+#include "protocolglue.h"
+const int gs_Msg_SixToSeven[49] = {
+0,1,2,3,5,-1,6,-1,8,9,10,11,12,13,14,15,16,-1,-1,24,25,26,27,-1,28,30,31,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,35,37,38,-1,-1,-1,-1
+};
+const int gs_Msg_SevenToSix[40] = {
+0,1,2,3,-1,4,6,-1,8,9,10,11,12,13,14,15,16,-1,-1,-1,-1,-1,-1,-1,19,20,21,22,24,-1,25,26,27,-1,-1,42,-1,43,44,-1
+};
+const int gs_Obj_SixToSeven[21] = {
+0,1,2,3,4,5,-1,6,9,10,11,-1,12,16,17,18,19,20,-1,21,-1
+};
+const int gs_Obj_SevenToSix[25] = {
+0,1,2,3,4,5,7,-1,-1,8,9,10,12,-1,-1,-1,13,14,15,16,17,19,-1,-1,-1
+};
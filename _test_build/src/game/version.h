@@ -0,0 +1,15 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#ifndef GAME_VERSION_H
+#define GAME_VERSION_H
+
+#define GAME_RELEASE_VERSION "1.5.1" ""
+#define GAME_NETVERSION_HASH "ecc3ccbeb9e57b75"
+#define GAME_VERSION "0.6.4, " GAME_RELEASE_VERSION
+#define GAME_NETVERSION "0.6 626fce9a778df4d4"
+#define CLIENT_VERSIONNR 16050
+
+#define LAST_COMPILE_DATE __DATE__
+extern const char *GIT_SHORTREV_HASH;
+#define GAME_NAME "Infclass"
+#endif
@@ -5,6 +5,12 @@
 static std::random_device RandomDevice;
 static std::mt19937 RandomEngine(RandomDevice());
 
+void random_seed(unsigned Seed)
+{
+	RandomEngine.seed(Seed);
+	srand(Seed);
+}
+
 bool random_prob(float f)
 {
 	return (random_float() < f);
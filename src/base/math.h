@@ -154,6 +154,8 @@ constexpr inline T in_range(T a, T upper)
 }
 
 // Infclass
+// makes the random functions reproducible, they are seeded from the random device by default
+void random_seed(unsigned Seed);
 bool random_prob(float f);
 int random_int(int Min, int Max);
 int random_distribution(double* pProb, double* pProb2);
@@ -40,6 +40,7 @@
 #include <netinet/in.h>
 #include <pthread.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 
 #include <dirent.h>
@@ -158,6 +159,19 @@ void net_buffer_init(NETSOCKET_BUFFER *buffer);
 void net_buffer_reinit(NETSOCKET_BUFFER *buffer);
 void net_buffer_simple(NETSOCKET_BUFFER *buffer, char **buf, int *size);
 
+#if defined(CONF_PLATFORM_LINUX)
+/* outgoing packets queued by net_udp_send until net_udp_flush */
+typedef struct
+{
+	int count;
+	int socks[VLEN];
+	struct mmsghdr msgs[VLEN];
+	struct iovec iovecs[VLEN];
+	char bufs[VLEN][PACKETSIZE];
+	struct sockaddr_in6 sockaddrs[VLEN];
+} NETSOCKET_SEND_BUFFER;
+#endif
+
 struct NETSOCKET_INTERNAL
 {
 	int type;
@@ -166,6 +180,9 @@ struct NETSOCKET_INTERNAL
 	int web_ipv4sock;
 
 	NETSOCKET_BUFFER buffer;
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_BUFFER *send_buffer;
+#endif
 };
 static NETSOCKET_INTERNAL invalid_socket = {NETTYPE_INVALID, -1, -1, -1};
 
@@ -445,6 +462,47 @@ int io_sync(IOHANDLE io)
 #endif
 }
 
+void *io_map(IOHANDLE io, unsigned *size)
+{
+	*size = 0;
+#if defined(CONF_FAMILY_WINDOWS)
+	HANDLE file = (HANDLE)_get_osfhandle(_fileno((FILE *)io));
+	LARGE_INTEGER length;
+	if(!GetFileSizeEx(file, &length) || length.QuadPart <= 0 || length.QuadPart > 0x7fffffff)
+		return nullptr;
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	if(!mapping)
+		return nullptr;
+	void *data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(mapping); // the view keeps the mapping alive
+	if(!data)
+		return nullptr;
+	*size = (unsigned)length.QuadPart;
+	return data;
+#else
+	int fd = fileno((FILE *)io);
+	struct stat sb;
+	if(fstat(fd, &sb) != 0 || sb.st_size <= 0 || sb.st_size > 0x7fffffff)
+		return nullptr;
+	void *data = mmap(nullptr, sb.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if(data == MAP_FAILED)
+		return nullptr;
+	*size = (unsigned)sb.st_size;
+	return data;
+#endif
+}
+
+void io_unmap(const void *data, unsigned size)
+{
+	if(!data)
+		return;
+#if defined(CONF_FAMILY_WINDOWS)
+	UnmapViewOfFile(data);
+#else
+	munmap(const_cast<void *>(data), size);
+#endif
+}
+
 #define ASYNC_BUFSIZE (8 * 1024)
 #define ASYNC_LOCAL_BUFSIZE (64 * 1024)
 
@@ -1405,6 +1463,15 @@ static void priv_net_close_socket(int sock)
 
 static int priv_net_close_all_sockets(NETSOCKET sock)
 {
+#if defined(CONF_PLATFORM_LINUX)
+	if(sock->send_buffer)
+	{
+		net_udp_flush(sock);
+		free(sock->send_buffer);
+		sock->send_buffer = NULL;
+	}
+#endif
+
 	/* close down ipv4 */
 	if(sock->ipv4sock >= 0)
 	{
@@ -1618,10 +1685,52 @@ NETSOCKET net_udp_create(NETADDR bindaddr)
 	return sock;
 }
 
+#if defined(CONF_PLATFORM_LINUX)
+static int priv_net_udp_queue(NETSOCKET sock, const NETADDR *addr, const void *data, int size)
+{
+	NETSOCKET_SEND_BUFFER *buffer = sock->send_buffer;
+	if(buffer->count == VLEN)
+		net_udp_flush(sock);
+
+	int i = buffer->count++;
+	if(addr->type == NETTYPE_IPV4)
+	{
+		netaddr_to_sockaddr_in(addr, (struct sockaddr_in *)&buffer->sockaddrs[i]);
+		buffer->msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+		buffer->socks[i] = sock->ipv4sock;
+	}
+	else
+	{
+		netaddr_to_sockaddr_in6(addr, &buffer->sockaddrs[i]);
+		buffer->msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in6);
+		buffer->socks[i] = sock->ipv6sock;
+	}
+	mem_copy(buffer->bufs[i], data, size);
+	buffer->iovecs[i].iov_len = size;
+
+	network_stats.sent_bytes += size;
+	network_stats.sent_packets++;
+	return size;
+}
+#endif
+
 int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size)
 {
 	int d = -1;
 
+#if defined(CONF_PLATFORM_LINUX)
+	if(sock->send_buffer && size <= PACKETSIZE &&
+		((addr->type == NETTYPE_IPV4 && sock->ipv4sock >= 0) || (addr->type == NETTYPE_IPV6 && sock->ipv6sock >= 0)))
+	{
+		return priv_net_udp_queue(sock, addr, data, size);
+	}
+	else if(sock->send_buffer)
+	{
+		/* keep the order of the packets */
+		net_udp_flush(sock);
+	}
+#endif
+
 	if(addr->type & NETTYPE_IPV4)
 	{
 		if(sock->ipv4sock >= 0)
@@ -1701,6 +1810,65 @@ int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size
 	return d;
 }
 
+void net_udp_set_send_batching(NETSOCKET sock, bool enable)
+{
+#if defined(CONF_PLATFORM_LINUX)
+	if(enable && !sock->send_buffer)
+	{
+		NETSOCKET_SEND_BUFFER *buffer = (NETSOCKET_SEND_BUFFER *)calloc(1, sizeof(*buffer));
+		for(int i = 0; i < VLEN; ++i)
+		{
+			buffer->iovecs[i].iov_base = buffer->bufs[i];
+			buffer->msgs[i].msg_hdr.msg_iov = &buffer->iovecs[i];
+			buffer->msgs[i].msg_hdr.msg_iovlen = 1;
+			buffer->msgs[i].msg_hdr.msg_name = &buffer->sockaddrs[i];
+		}
+		sock->send_buffer = buffer;
+	}
+	else if(!enable && sock->send_buffer)
+	{
+		net_udp_flush(sock);
+		free(sock->send_buffer);
+		sock->send_buffer = NULL;
+	}
+#endif
+}
+
+int net_udp_flush(NETSOCKET sock)
+{
+	int sent = 0;
+#if defined(CONF_PLATFORM_LINUX)
+	NETSOCKET_SEND_BUFFER *buffer = sock->send_buffer;
+	if(!buffer)
+		return 0;
+
+	int start = 0;
+	while(start < buffer->count)
+	{
+		/* one call for each run of packets going through the same socket */
+		int end = start + 1;
+		while(end < buffer->count && buffer->socks[end] == buffer->socks[start])
+			end++;
+
+		while(start < end)
+		{
+			int num = sendmmsg(buffer->socks[start], &buffer->msgs[start], end - start, 0);
+			if(num <= 0)
+			{
+				/* drop the packet which failed, like a failed sendto */
+				start++;
+				continue;
+			}
+			network_stats.sent_syscalls_saved += num - 1;
+			sent += num;
+			start += num;
+		}
+	}
+	buffer->count = 0;
+#endif
+	return sent;
+}
+
 void net_buffer_init(NETSOCKET_BUFFER *buffer)
 {
 #if defined(CONF_PLATFORM_LINUX)
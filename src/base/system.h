@@ -358,6 +358,32 @@ long int io_tell(IOHANDLE io);
  */
 long int io_length(IOHANDLE io);
 
+/**
+ * Maps the whole file copy-on-write into memory.
+ *
+ * @ingroup File-IO
+ *
+ * @param io Handle to the file, opened for reading.
+ * @param size Receives the size of the mapping.
+ *
+ * @return Pointer to the mapped file, @c nullptr on error or for an empty file.
+ *
+ * @remark Changes to the memory are private and never written to the file.
+ * @remark The mapping stays valid after the file is closed and must be freed with @link io_unmap @endlink.
+ * @remark The file should not be truncated or overwritten in place while it is mapped.
+ */
+void *io_map(IOHANDLE io, unsigned *size);
+
+/**
+ * Frees a mapping created by @link io_map @endlink.
+ *
+ * @ingroup File-IO
+ *
+ * @param data Pointer to the mapped file.
+ * @param size Size of the mapping.
+ */
+void io_unmap(const void *data, unsigned size);
+
 /**
  * Closes a file.
  *
@@ -897,6 +923,32 @@ NETSOCKET net_udp_create(NETADDR bindaddr);
  */
 int net_udp_send(NETSOCKET sock, const NETADDR *addr, const void *data, int size);
 
+/**
+ * Makes net_udp_send queue the packets of an UDP socket until they are
+ * sent together by net_udp_flush.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ * @param enable Whether to queue the outgoing packets.
+ *
+ * @remark Only batches on Linux (sendmmsg), elsewhere the packets are
+ * still sent right away.
+ * @remark Disabling the batching flushes the queued packets.
+ */
+void net_udp_set_send_batching(NETSOCKET sock, bool enable);
+
+/**
+ * Sends the packets queued on an UDP socket.
+ *
+ * @ingroup Network-UDP
+ *
+ * @param sock Socket to use.
+ *
+ * @return The number of packets sent.
+ */
+int net_udp_flush(NETSOCKET sock);
+
 /*
 	Function: net_udp_recv
 		Receives a packet over an UDP socket.
@@ -2085,6 +2137,7 @@ typedef struct
 	uint64_t sent_bytes;
 	uint64_t recv_packets;
 	uint64_t recv_bytes;
+	uint64_t sent_syscalls_saved;
 } NETSTATS;
 
 void net_stats(NETSTATS *stats);
@@ -102,9 +102,15 @@ class IDemoRecorder : public IInterface
 {
 	MACRO_INTERFACE("demorecorder")
 public:
+	enum class EStopMode
+	{
+		KEEP_FILE,
+		REMOVE_FILE,
+	};
+
 	~IDemoRecorder() {}
 	virtual bool IsRecording() const = 0;
-	virtual int Stop() = 0;
+	virtual int Stop(IDemoRecorder::EStopMode Mode, const char *pTargetFilename = "") = 0;
 	virtual int Length() const = 0;
 	virtual char *GetCurrentFilename() = 0;
 };
@@ -33,6 +33,8 @@ class IEngineMap : public IMap
 	MACRO_INTERFACE("enginemap")
 public:
 	virtual bool Load(const char *pMapName) = 0;
+	// Memory maps the file instead of reading it, see CDataFileReader::OpenMapped()
+	virtual bool LoadMapped(const char *pMapName) = 0;
 	virtual void Unload() = 0;
 	virtual bool IsLoaded() const = 0;
 	virtual IOHANDLE File() const = 0;
@@ -17,6 +17,8 @@
 #include <game/generated/protocolglue.h>
 
 struct CAntibotRoundData;
+class CProfiler;
+class CSnapshotItemRecord;
 
 enum class EClientDropType;
 
@@ -341,6 +343,12 @@ public:
 
 	virtual void SnapSetStaticsize(int ItemType, int Size) = 0;
 
+	// Captures the items created until SnapStopRecording(), so that they
+	// can be copied into the snapshots of other clients with SnapAddRecord()
+	virtual void SnapStartRecording() = 0;
+	virtual void SnapStopRecording(CSnapshotItemRecord *pRecord) = 0;
+	virtual void SnapAddRecord(const CSnapshotItemRecord &Record) = 0;
+
 	enum
 	{
 		RCON_CID_SERV = -1,
@@ -353,6 +361,8 @@ public:
 	virtual void RedirectClient(int ClientID, int Port, bool Verbose = false) = 0;
 	virtual bool GetMapReload() const = 0;
 	virtual void ChangeMap(const char *pMap) = 0;
+	// Converts the client map in the background so a later change to the map is quick
+	virtual void PrepareMap(const char *pMap) = 0;
 
 	virtual void DemoRecorder_HandleAutoStart() = 0;
 
@@ -385,6 +395,8 @@ public:
 
 	virtual bool IsSixup(int ClientID) const = 0;
 
+	virtual CProfiler *Profiler() = 0;
+
 /* INFECTION MODIFICATION START ***************************************/
 	virtual int GetClientInfclassVersion(int ClientID) const = 0;
 
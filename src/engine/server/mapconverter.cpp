@@ -220,13 +220,14 @@ void SetQuadColor(CQuad *Quad, int Color)
 	Quad->m_aColors[3] = TypedColor;
 }
 
-CMapConverter::CMapConverter(IStorage *pStorage, IEngineMap *pMap, IConsole* pConsole) :
+CMapConverter::CMapConverter(IStorage *pStorage, IEngineMap *pMap, IConsole* pConsole, IEngine *pEngine) :
 	m_pStorage(pStorage),
 	m_pMap(pMap),
 	m_pConsole(pConsole),
 	m_pTiles(0)
 {
 	m_DataFile.Init();
+	m_DataFile.SetParallelCompression(pEngine);
 }
 
 CMapConverter::~CMapConverter()
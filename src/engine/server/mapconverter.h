@@ -96,7 +96,8 @@ protected:
 	int Finalize();
 
 public:
-	CMapConverter(IStorage *pStorage, IEngineMap *pMap, IConsole* pConsole);
+	// With an engine the map data is compressed in parallel on its job pool
+	CMapConverter(IStorage *pStorage, IEngineMap *pMap, IConsole* pConsole, IEngine *pEngine = nullptr);
 	~CMapConverter();
 	
 	bool Load();
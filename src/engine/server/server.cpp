@@ -6,6 +6,7 @@
 #include <base/logger.h>
 #include <base/math.h>
 #include <base/system.h>
+#include <base/tl/threading.h>
 
 #include <engine/config.h>
 #include <engine/console.h>
@@ -21,6 +22,7 @@
 #include <engine/shared/econ.h>
 #include <engine/shared/filecollection.h>
 #include <engine/shared/http.h>
+#include <engine/shared/jobs.h>
 #include <engine/shared/json.h>
 #include <engine/shared/masterserver.h>
 #include <engine/shared/netban.h>
@@ -36,6 +38,7 @@
 #include <game/version.h>
 
 #include <engine/shared/linereader.h>
+#include <engine/shared/map.h>
 
 #include "server.h"
 
@@ -52,7 +55,10 @@
 #include "databases/connection_pool.h"
 #include "register.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <vector>
 
 extern const char *GIT_SHORTREV_HASH;
 
@@ -381,6 +387,31 @@ CServer::CServer()
 	for(int i = 0; i < MAX_CLIENTS; i++)
 		m_aDemoRecorder[i] = CDemoRecorder(&m_SnapshotDelta, true);
 	m_aDemoRecorder[MAX_CLIENTS] = CDemoRecorder(&m_SnapshotDelta, false);
+	m_NumPlayerDemos = 0;
+	mem_zero(m_aaPlayerDemoTmpFilename, sizeof(m_aaPlayerDemoTmpFilename));
+
+	// set once, the demo writer thread reads m_SnapshotDelta, see SnapSetStaticsize()
+	m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_SOUNDWORLD, false);
+	m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_DAMAGE, false);
+	m_SnapshotDeltaSixup.SetStaticsize(protocol7::NETEVENTTYPE_SOUNDWORLD, true);
+	m_SnapshotDeltaSixup.SetStaticsize(protocol7::NETEVENTTYPE_DAMAGE, true);
+
+	sphore_init(&m_SnapshotJobsDone);
+
+	m_ProfileScopeInput = m_Profiler.AddScope("input");
+	m_ProfileScopeGame = m_Profiler.AddScope("game");
+	m_ProfileScopeSql = m_Profiler.AddScope("sql");
+	m_ProfileScopeSnapshot = m_Profiler.AddScope("snapshot");
+	m_ProfileScopeSnap = m_Profiler.AddScope("snap", m_ProfileScopeSnapshot);
+	m_ProfileScopeDelta = m_Profiler.AddScope("delta", m_ProfileScopeSnapshot);
+	m_ProfileScopeSend = m_Profiler.AddScope("send", m_ProfileScopeSnapshot);
+	m_ProfileScopeNetwork = m_Profiler.AddScope("network");
+	m_Profiler.SetTickBudget(time_freq() / SERVER_TICK_SPEED);
+	m_LastPerfEconTime = 0;
+
+	m_Headless = false;
+	mem_zero(m_aHeadlessSnapshots, sizeof(m_aHeadlessSnapshots));
+	mem_zero(m_aHeadlessSnapshotBytes, sizeof(m_aHeadlessSnapshotBytes));
 
 	m_TickSpeed = SERVER_TICK_SPEED;
 
@@ -413,6 +444,7 @@ CServer::CServer()
 #endif
 
 	m_pConnectionPool = new CDbConnectionPool();
+	m_pEngine = nullptr;
 	m_pRegister = nullptr;
 
 	m_aErrorShutdownReason[0] = 0;
@@ -422,10 +454,8 @@ CServer::CServer()
 
 CServer::~CServer()
 {
-	for(auto &pCurrentMapData : m_apCurrentMapData)
-	{
-		free(pCurrentMapData);
-	}
+	free(m_apCurrentMapData[MAP_TYPE_SIXUP]);
+	m_pCurrentClientMap.reset();
 
 	if(m_RunServer != UNINITIALIZED)
 	{
@@ -437,6 +467,8 @@ CServer::~CServer()
 
 	delete m_pRegister;
 	delete m_pConnectionPool;
+
+	sphore_destroy(&m_SnapshotJobsDone);
 }
 
 bool CServer::IsClientNameAvailable(int ClientID, const char *pNameRequest)
@@ -882,7 +914,9 @@ int CServer::Port() const
 
 int CServer::MaxClients() const
 {
-	return m_RunServer == UNINITIALIZED ? 0 : m_NetServer.MaxClients();
+	if(m_RunServer == UNINITIALIZED)
+		return 0;
+	return m_Headless ? Config()->m_SvMaxClients : m_NetServer.MaxClients();
 }
 
 int CServer::ClientCount() const
@@ -1083,6 +1117,85 @@ void CServer::SendMsgRaw(int ClientID, const void *pData, int Size, int Flags)
 	m_NetServer.Send(&Packet);
 }
 
+class CSnapshotJob : public IJob
+{
+	const CSnapshotDelta *m_pSnapshotDelta;
+	CServer::CSnapshotSlot *m_pSlot;
+	SEMAPHORE *m_pDone;
+
+	void Run() override
+	{
+		char aDeltaData[CSnapshot::MAX_SIZE];
+		int DeltaSize = m_pSnapshotDelta->CreateDelta(m_pSlot->m_pDeltashot, (CSnapshot *)m_pSlot->m_aData, aDeltaData);
+		if(DeltaSize)
+			m_pSlot->m_CompSize = CVariableInt::Compress(aDeltaData, DeltaSize, m_pSlot->m_aCompData, sizeof(m_pSlot->m_aCompData));
+		else
+			m_pSlot->m_CompSize = 0;
+		sphore_signal(m_pDone);
+	}
+
+public:
+	CSnapshotJob(const CSnapshotDelta *pSnapshotDelta, CServer::CSnapshotSlot *pSlot, SEMAPHORE *pDone) :
+		m_pSnapshotDelta(pSnapshotDelta), m_pSlot(pSlot), m_pDone(pDone)
+	{
+	}
+};
+
+void CServer::SendSnapshot(int ClientID, int Crc, int DeltaTick, const char *pCompData, int CompSize)
+{
+	if(m_Headless)
+	{
+		// counted instead of sent, and acked at once like by a client without latency
+		m_aHeadlessSnapshots[ClientID]++;
+		m_aHeadlessSnapshotBytes[ClientID] += CompSize;
+		m_aClients[ClientID].m_LastAckedSnapshot = m_CurrentGameTick;
+		m_aClients[ClientID].m_SnapRate = CClient::SNAPRATE_FULL;
+		return;
+	}
+
+	if(CompSize)
+	{
+		const int MaxSize = MAX_SNAPSHOT_PACKSIZE;
+		int NumPackets = (CompSize + MaxSize - 1) / MaxSize;
+
+		for(int n = 0, Left = CompSize; Left > 0; n++)
+		{
+			int Chunk = Left < MaxSize ? Left : MaxSize;
+			Left -= Chunk;
+
+			if(NumPackets == 1)
+			{
+				CMsgPacker Msg(NETMSG_SNAPSINGLE, true);
+				Msg.AddInt(m_CurrentGameTick);
+				Msg.AddInt(m_CurrentGameTick - DeltaTick);
+				Msg.AddInt(Crc);
+				Msg.AddInt(Chunk);
+				Msg.AddRaw(&pCompData[n * MaxSize], Chunk);
+				SendMsg(&Msg, MSGFLAG_FLUSH, ClientID);
+			}
+			else
+			{
+				CMsgPacker Msg(NETMSG_SNAP, true);
+				Msg.AddInt(m_CurrentGameTick);
+				Msg.AddInt(m_CurrentGameTick - DeltaTick);
+				Msg.AddInt(NumPackets);
+				Msg.AddInt(n);
+				Msg.AddInt(Crc);
+				Msg.AddInt(Chunk);
+				Msg.AddRaw(&pCompData[n * MaxSize], Chunk);
+				SendMsg(&Msg, MSGFLAG_FLUSH, ClientID);
+			}
+		}
+	}
+	else
+	{
+		CMsgPacker Msg(NETMSG_SNAPEMPTY, true);
+		Msg.AddInt(m_CurrentGameTick);
+		Msg.AddInt(m_CurrentGameTick - DeltaTick);
+		SendMsg(&Msg, MSGFLAG_FLUSH, ClientID);
+	}
+}
+
 void CServer::DoSnapshot()
 {
 	GameServer()->OnPreSnap();
@@ -1093,6 +1206,7 @@ void CServer::DoSnapshot()
 		char aData[CSnapshot::MAX_SIZE];
 
 		// build snap and possibly add some messages
+		CProfileScope Scope(&m_Profiler, m_ProfileScopeSnap);
 		m_SnapshotBuilder.Init();
 		GameServer()->OnSnap(-1);
 		int SnapshotSize = m_SnapshotBuilder.Finish(aData);
@@ -1101,6 +1215,11 @@ void CServer::DoSnapshot()
 		m_aDemoRecorder[MAX_CLIENTS].RecordSnapshot(Tick(), aData, SnapshotSize);
 	}
 
+	// the world is snapped on the main thread, delta and compression go to the job pool
+	const bool Parallel = Config()->m_SvParallelSnapshots && m_pEngine;
+	int aJobClients[MAX_CLIENTS];
+	int NumJobs = 0;
+
 	// create snapshots for all clients
 	for(int i = 0; i < MaxClients(); i++)
 	{
@@ -1109,7 +1228,7 @@ void CServer::DoSnapshot()
 			continue;
 
 		// client must be human to recive snapshots
-		if(m_aClients[i].m_IsBot)
+		if(m_aClients[i].m_IsBot && !m_Headless)
 			continue;
 
 		// this client is trying to recover, don't spam snapshots
@@ -1121,19 +1240,28 @@ void CServer::DoSnapshot()
 			continue;
 
 		{
+			m_Profiler.Begin(m_ProfileScopeSnap);
 			m_SnapshotBuilder.Init(m_aClients[i].m_Sixup);
 
 			GameServer()->OnSnap(i);
 
 			// finish snapshot
 			char aData[CSnapshot::MAX_SIZE];
-			CSnapshot *pData = (CSnapshot *)aData; // Fix compiler warning for strict-aliasing
+			char *pSnapData = aData;
+			if(Parallel)
+			{
+				if(!m_apSnapshotSlots[i])
+					m_apSnapshotSlots[i] = std::make_unique<CSnapshotSlot>();
+				pSnapData = m_apSnapshotSlots[i]->m_aData;
+			}
+			CSnapshot *pData = (CSnapshot *)pSnapData; // Fix compiler warning for strict-aliasing
 			int SnapshotSize = m_SnapshotBuilder.Finish(pData);
+			m_Profiler.End(m_ProfileScopeSnap);
 
 			if(m_aDemoRecorder[i].IsRecording())
 			{
 				// write snapshot
-				m_aDemoRecorder[i].RecordSnapshot(Tick(), aData, SnapshotSize);
+				m_aDemoRecorder[i].RecordSnapshot(Tick(), pSnapData, SnapshotSize);
 			}
 
 			int Crc = pData->Crc();
@@ -1160,61 +1288,175 @@ void CServer::DoSnapshot()
 				}
 			}
 
+			if(Parallel)
+			{
+				CSnapshotSlot *pSlot = m_apSnapshotSlots[i].get();
+				pSlot->m_pDeltashot = pDeltashot;
+				pSlot->m_DeltaTick = DeltaTick;
+				pSlot->m_Crc = Crc;
+				m_pEngine->AddJob(std::make_shared<CSnapshotJob>(SnapshotDelta(i), pSlot, &m_SnapshotJobsDone));
+				aJobClients[NumJobs++] = i;
+				continue;
+			}
+
 			// create delta
-			m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_SOUNDWORLD, m_aClients[i].m_Sixup);
-			m_SnapshotDelta.SetStaticsize(protocol7::NETEVENTTYPE_DAMAGE, m_aClients[i].m_Sixup);
+			m_Profiler.Begin(m_ProfileScopeDelta);
 			char aDeltaData[CSnapshot::MAX_SIZE];
-			int DeltaSize = m_SnapshotDelta.CreateDelta(pDeltashot, pData, aDeltaData);
+			int DeltaSize = SnapshotDelta(i)->CreateDelta(pDeltashot, pData, aDeltaData);
 
+			// compress it
+			char aCompData[CSnapshot::MAX_SIZE];
+			int CompSize = 0;
 			if(DeltaSize)
+				CompSize = CVariableInt::Compress(aDeltaData, DeltaSize, aCompData, sizeof(aCompData));
+			m_Profiler.End(m_ProfileScopeDelta);
+
+			CProfileScope Scope(&m_Profiler, m_ProfileScopeSend);
+			SendSnapshot(i, Crc, DeltaTick, aCompData, CompSize);
+		}
+	}
+
+	// join the snapshot jobs and send in client order, the network is only touched on the main thread
+	{
+		// only the time the main thread waits for the jobs is counted
+		CProfileScope Scope(&m_Profiler, m_ProfileScopeDelta);
+		for(int j = 0; j < NumJobs; j++)
+			sphore_wait(&m_SnapshotJobsDone);
+	}
+	CProfileScope Scope(&m_Profiler, m_ProfileScopeSend);
+	for(int j = 0; j < NumJobs; j++)
+	{
+		const CSnapshotSlot *pSlot = m_apSnapshotSlots[aJobClients[j]].get();
+		SendSnapshot(aJobClients[j], pSlot->m_Crc, pSlot->m_DeltaTick, pSlot->m_aCompData, pSlot->m_CompSize);
+	}
+
+	GameServer()->OnPostSnap();
+}
+
+void CServer::AddClientInput(int ClientID, int IntendedTick, const int *pData, int Num)
+{
+	m_InputTrace.Input(ClientID, IntendedTick - Tick(), pData, Num);
+
+	CClient::CInput *pInput = &m_aClients[ClientID].m_aInputs[m_aClients[ClientID].m_CurrentInput];
+
+	if(IntendedTick <= Tick())
+		IntendedTick = Tick() + 1;
+
+	pInput->m_GameTick = IntendedTick;
+	mem_copy(pInput->m_aData, pData, Num * sizeof(int));
+
+	GameServer()->OnClientPrepareInput(ClientID, pInput->m_aData);
+	mem_copy(m_aClients[ClientID].m_LatestInput.m_aData, pInput->m_aData, MAX_INPUT_SIZE * sizeof(int));
+
+	m_aClients[ClientID].m_CurrentInput++;
+	m_aClients[ClientID].m_CurrentInput %= 200;
+
+	// call the mod with the fresh input data
+	if(m_aClients[ClientID].m_State == CClient::STATE_INGAME)
+		GameServer()->OnClientDirectInput(ClientID, m_aClients[ClientID].m_LatestInput.m_aData);
+}
+
+void CServer::DoTick()
+{
+	m_InputTrace.Tick();
+
+	m_Profiler.Begin(m_ProfileScopeInput);
+	for(int c = 0; c < MAX_CLIENTS; c++)
+	{
+		if(m_aClients[c].m_State != CClient::STATE_INGAME)
+			continue;
+		bool ClientHadInput = false;
+		for(auto &Input : m_aClients[c].m_aInputs)
+		{
+			if(Input.m_GameTick == Tick() + 1)
 			{
-				// compress it
-				const int MaxSize = MAX_SNAPSHOT_PACKSIZE;
+				GameServer()->OnClientPredictedEarlyInput(c, Input.m_aData);
+				ClientHadInput = true;
+			}
+		}
+		if(!ClientHadInput)
+			GameServer()->OnClientPredictedEarlyInput(c, nullptr);
+	}
+	m_Profiler.End(m_ProfileScopeInput);
 
-				char aCompData[CSnapshot::MAX_SIZE];
-				SnapshotSize = CVariableInt::Compress(aDeltaData, DeltaSize, aCompData, sizeof(aCompData));
-				int NumPackets = (SnapshotSize + MaxSize - 1) / MaxSize;
+	m_CurrentGameTick++;
 
-				for(int n = 0, Left = SnapshotSize; Left > 0; n++)
+	//Check for name collision. We add this because the login is in a different thread and can't check it himself.
+	for(int i=MAX_CLIENTS-1; i>=0; i--)
+	{
+		if(m_aClients[i].m_State >= CClient::STATE_READY && m_aClients[i].m_Session.m_MuteTick > 0)
+			m_aClients[i].m_Session.m_MuteTick--;
+	}
+	
+	for(int ClientID=0; ClientID<MAX_CLIENTS; ClientID++)
+	{
+		if(m_aClients[ClientID].m_WaitingTime > 0)
+		{
+			m_aClients[ClientID].m_WaitingTime--;
+			if(m_aClients[ClientID].m_WaitingTime <= 0)
+			{
+				if(m_aClients[ClientID].m_State == CClient::STATE_READY)
 				{
-					int Chunk = Left < MaxSize ? Left : MaxSize;
-					Left -= Chunk;
-
-					if(NumPackets == 1)
+					void *pPersistentData = 0;
+					if(m_aClients[ClientID].m_HasPersistentData)
 					{
-						CMsgPacker Msg(NETMSG_SNAPSINGLE, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i);
-					}
-					else
-					{
-						CMsgPacker Msg(NETMSG_SNAP, true);
-						Msg.AddInt(m_CurrentGameTick);
-						Msg.AddInt(m_CurrentGameTick - DeltaTick);
-						Msg.AddInt(NumPackets);
-						Msg.AddInt(n);
-						Msg.AddInt(Crc);
-						Msg.AddInt(Chunk);
-						Msg.AddRaw(&aCompData[n * MaxSize], Chunk);
-						SendMsg(&Msg, MSGFLAG_FLUSH, i);
+						pPersistentData = m_aClients[ClientID].m_pPersistentData;
+						m_aClients[ClientID].m_HasPersistentData = false;
 					}
+
+					GameServer()->OnClientConnected(ClientID, pPersistentData);
+					SendConnectionReady(ClientID);
+				}
+				else if(m_aClients[ClientID].m_State == CClient::STATE_INGAME)
+				{
+					GameServer()->OnClientEnter(ClientID);
 				}
 			}
-			else
+		}
+	}
+
+	// apply new input
+	m_Profiler.Begin(m_ProfileScopeInput);
+	for(int c = 0; c < MAX_CLIENTS; c++)
+	{
+		if(m_aClients[c].m_State != CClient::STATE_INGAME)
+			continue;
+		bool ClientHadInput = false;
+		for(auto &Input : m_aClients[c].m_aInputs)
+		{
+			if(Input.m_GameTick == Tick())
 			{
-				CMsgPacker Msg(NETMSG_SNAPEMPTY, true);
-				Msg.AddInt(m_CurrentGameTick);
-				Msg.AddInt(m_CurrentGameTick - DeltaTick);
-				SendMsg(&Msg, MSGFLAG_FLUSH, i);
+				GameServer()->OnClientPredictedInput(c, Input.m_aData);
+				ClientHadInput = true;
+				break;
 			}
 		}
+		if(!ClientHadInput)
+			GameServer()->OnClientPredictedInput(c, nullptr);
 	}
+	m_Profiler.End(m_ProfileScopeInput);
 
-	GameServer()->OnPostSnap();
+	m_Profiler.Begin(m_ProfileScopeGame);
+	GameServer()->OnTick();
+	m_Profiler.End(m_ProfileScopeGame);
+	
+#ifdef CONF_SQL
+	if(m_lGameServerCmds.size())
+	{
+		CProfileScope Scope(&m_Profiler, m_ProfileScopeSql);
+		lock_wait(m_GameServerCmdLock);
+		for(int i=0; i<m_lGameServerCmds.size(); i++)
+		{
+			m_lGameServerCmds[i]->Execute(GameServer());
+			delete m_lGameServerCmds[i];
+		}
+		m_lGameServerCmds.clear();
+		lock_release(m_GameServerCmdLock);
+	} 
+#endif
+	// one sample per tick, the snapshot and the network of the
+	// previous frame are counted in the first tick of this one
+	m_Profiler.EndTick();
 }
 
 int CServer::ClientRejoinCallback(int ClientID, void *pUser)
@@ -1254,6 +1496,7 @@ int CServer::NewBot(int ClientID)
 {
 	if(m_aClients[ClientID].m_State > CClient::STATE_EMPTY && !m_aClients[ClientID].m_IsBot)
 		return 1;
+	m_aClients[ClientID].Reset();
 	m_aClients[ClientID].m_State = CClient::STATE_INGAME;
 	m_aClients[ClientID].m_Country = -1;
 	m_aClients[ClientID].m_UserID = -1;
@@ -1361,6 +1604,8 @@ int CServer::DelClientCallback(int ClientID, EClientDropType Type, const char *p
 	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_ADDINFO, "server", aBuf);
 
 	// notify the mod about the drop
+	if(pThis->m_aClients[ClientID].m_State >= CClient::STATE_READY)
+		pThis->m_InputTrace.Drop(ClientID, (int)Type, pReason);
 	if(pThis->m_aClients[ClientID].m_State >= CClient::STATE_READY && pThis->m_aClients[ClientID].m_WaitingTime <= 0)
 		pThis->GameServer()->OnClientDrop(ClientID, Type, pReason);
 
@@ -1594,78 +1839,195 @@ static inline int MsgFromSixup(int Msg, bool System)
 	return Msg;
 }
 
-bool CServer::GenerateClientMap(const char *pMapFilePath, const char *pMapName)
+bool CServer::ConvertClientMap(IEngine *pEngine, IStorage *pStorage, IConsole *pConsole, IEngineMap *pMap, const char *pMapName, const char *pConverterId, bool ForceRegeneration, bool Mapped, CClientMapData *pOut)
 {
-	if(!m_pMap->Load(pMapFilePath))
-		return 0;
-
 	//The map format of InfectionClass is different from the vanilla format.
 	//We need to convert the map to something that the client can use
 	//First, try to find if the client map is already generated
 
-	CDataFileReader dfServerMap;
-	dfServerMap.Open(Storage(), pMapFilePath, IStorage::TYPE_ALL);
-	unsigned ServerMapCrc = dfServerMap.Crc();
-	dfServerMap.Close();
-
-	EventsDirector::SetPreloadedMapName(pMapName);
+	pOut->m_ServerMapCrc = pMap->Crc();
 
 	char aClientMapDir[256];
 	char aClientMapName[256];
-	const char *pConverterId = Config()->m_InfConverterId;
-	pConverterId = EventsDirector::GetMapConverterId(pConverterId);
 	str_format(aClientMapDir, sizeof(aClientMapDir), "clientmaps/%s", pConverterId);
-	str_format(aClientMapName, sizeof(aClientMapName), "%s/%s_%08x.map", aClientMapDir, pMapName, ServerMapCrc);
+	str_format(aClientMapName, sizeof(aClientMapName), "%s/%s_%08x.map", aClientMapDir, pMapName, pOut->m_ServerMapCrc);
 
-	CMapConverter MapConverter(Storage(), m_pMap, Console());
+	CMapConverter MapConverter(pStorage, pMap, pConsole, pEngine);
 	if(!MapConverter.Load())
 		return false;
 
-	m_TimeShiftUnit = MapConverter.GetTimeShiftUnit();
+	pOut->m_TimeShiftUnit = MapConverter.GetTimeShiftUnit();
+
+	CDataFileReader &ClientMapFile = pOut->m_ClientMapFile;
+	auto OpenClientMap = [&]() {
+		if(Mapped)
+			return ClientMapFile.OpenMapped(pStorage, aClientMapName, IStorage::TYPE_ALL);
+		return ClientMapFile.Open(pStorage, aClientMapName, IStorage::TYPE_ALL);
+	};
 
-	CDataFileReader dfClientMap;
-	//The map is already converted
-	if(!Config()->m_InfConverterForceRegeneration && dfClientMap.Open(Storage(), aClientMapName, IStorage::TYPE_ALL))
-	{
-		m_aCurrentMapCrc[MAP_TYPE_SIX] = dfClientMap.Crc();
-		m_aCurrentMapSha256[MAP_TYPE_SIX] = dfClientMap.Sha256();
-		dfClientMap.Close();
-	}
 	//The map must be converted
-	else
+	if(ForceRegeneration || !OpenClientMap())
 	{
 		char aFullPath[512];
-		Storage()->GetCompletePath(IStorage::TYPE_SAVE, aClientMapDir, aFullPath, sizeof(aFullPath));
+		pStorage->GetCompletePath(IStorage::TYPE_SAVE, aClientMapDir, aFullPath, sizeof(aFullPath));
 		if(fs_makedir_rec_for(aFullPath) != 0 || fs_makedir(aFullPath) != 0)
 		{
 			dbg_msg("infclass", "Can't create the directory '%s'", aClientMapDir);
 		}
 
-		if(!MapConverter.CreateMap(aClientMapName))
+		// write a new file and replace the old one, so a mapped old file stays intact.
+		// The name is unique per conversion, a replaced job may still convert the same map.
+		static std::atomic<int> s_NumConversions(0);
+		char aTmpName[256];
+		str_format(aTmpName, sizeof(aTmpName), "%s.%d.%d.tmp", aClientMapName, pid(), s_NumConversions++);
+		if(!MapConverter.CreateMap(aTmpName))
+			return false;
+		if(!pStorage->RenameFile(aTmpName, aClientMapName, IStorage::TYPE_SAVE))
+		{
+			dbg_msg("infclass", "Can't replace the client map '%s'", aClientMapName);
+			pStorage->RemoveFile(aTmpName, IStorage::TYPE_SAVE);
+			return false;
+		}
+
+		if(!OpenClientMap())
 			return false;
+	}
+
+	pOut->m_Crc = ClientMapFile.Crc();
+	pOut->m_Sha256 = ClientMapFile.Sha256();
+
+	// serve the downloads straight from the mapped file
+	const void *pMappedFile = ClientMapFile.MappedFile(&pOut->m_DataSize);
+	if(pMappedFile)
+	{
+		pOut->m_pData = (unsigned char *)pMappedFile;
+		pOut->m_DataMapped = true;
+		return true;
+	}
+	ClientMapFile.Close();
+
+	// load complete map into memory for download
+	void *pData;
+	if(!pStorage->ReadFile(aClientMapName, IStorage::TYPE_ALL, &pData, &pOut->m_DataSize))
+		return false;
+	pOut->m_pData = (unsigned char *)pData;
+
+	return true;
+}
+
+class CMapPrepareJob : public IJob
+{
+	IEngine *m_pEngine;
+	IStorage *m_pStorage;
+	IConsole *m_pConsole;
+	char m_aMapFilePath[IO_MAX_PATH_LENGTH];
+	bool m_ForceRegeneration;
+	bool m_Mapped;
+	CSemaphore m_Finished;
+
+	void Run() override
+	{
+		CMap Map;
+		if(Map.Load(m_pStorage, m_aMapFilePath, m_Mapped))
+			m_Success = CServer::ConvertClientMap(m_pEngine, m_pStorage, m_pConsole, &Map, m_pClientMap->m_aMapName, m_pClientMap->m_aConverterId, m_ForceRegeneration, m_Mapped, m_pClientMap.get());
+		m_Finished.Signal();
+	}
+
+public:
+	std::unique_ptr<CServer::CClientMapData> m_pClientMap;
+	bool m_Success = false;
+
+	// blocks until Run() no longer uses the storage and the console, call it once
+	void WaitFinished() { m_Finished.Wait(); }
+
+	CMapPrepareJob(IEngine *pEngine, IStorage *pStorage, IConsole *pConsole, const char *pMapName, const char *pConverterId, bool ForceRegeneration, bool Mapped) :
+		m_pEngine(pEngine), m_pStorage(pStorage), m_pConsole(pConsole), m_ForceRegeneration(ForceRegeneration), m_Mapped(Mapped),
+		m_pClientMap(std::make_unique<CServer::CClientMapData>())
+	{
+		str_format(m_aMapFilePath, sizeof(m_aMapFilePath), "maps/%s.map", pMapName);
+		str_copy(m_pClientMap->m_aMapName, pMapName);
+		str_copy(m_pClientMap->m_aConverterId, pConverterId);
+	}
+};
+
+void CServer::PrepareMap(const char *pMap)
+{
+	// the event maps change the global converter state, keep loading them on the main thread
+	if(!Config()->m_SvMapBackgroundLoad || !m_pEngine || Config()->m_InfEvent[0] || !str_startswith(pMap, "infc_"))
+		return;
+
+	if(m_pMapPrepareJob &&
+		str_comp(m_pMapPrepareJob->m_pClientMap->m_aMapName, pMap) == 0 &&
+		str_comp(m_pMapPrepareJob->m_pClientMap->m_aConverterId, Config()->m_InfConverterId) == 0)
+	{
+		return;
+	}
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "preparing map '%s' in the background", pMap);
+	Console()->Print(IConsole::OUTPUT_LEVEL_ADDINFO, "server", aBuf);
+
+	// a replaced job keeps running, the shutdown waits for it
+	m_vpMapPrepareJobs.erase(std::remove_if(m_vpMapPrepareJobs.begin(), m_vpMapPrepareJobs.end(), [](const std::shared_ptr<CMapPrepareJob> &pJob) {
+		return pJob->Done();
+	}),
+		m_vpMapPrepareJobs.end());
+	m_pMapPrepareJob = std::make_shared<CMapPrepareJob>(m_pEngine, Storage(), Console(), pMap, Config()->m_InfConverterId, Config()->m_InfConverterForceRegeneration, Config()->m_SvMapMmap);
+	m_vpMapPrepareJobs.push_back(m_pMapPrepareJob);
+	m_pEngine->AddJob(m_pMapPrepareJob);
+}
+
+bool CServer::IsMapPreparing(const char *pMapName)
+{
+	PrepareMap(pMapName);
+	return m_pMapPrepareJob && !m_pMapPrepareJob->Done() && str_comp(m_pMapPrepareJob->m_pClientMap->m_aMapName, pMapName) == 0;
+}
+
+bool CServer::GenerateClientMap(const char *pMapFilePath, const char *pMapName)
+{
+	if(!(Config()->m_SvMapMmap ? m_pMap->LoadMapped(pMapFilePath) : m_pMap->Load(pMapFilePath)))
+		return 0;
+
+	EventsDirector::SetPreloadedMapName(pMapName);
+
+	const char *pConverterId = Config()->m_InfConverterId;
+	pConverterId = EventsDirector::GetMapConverterId(pConverterId);
 
-		CDataFileReader dfGeneratedMap;
-		dfGeneratedMap.Open(Storage(), aClientMapName, IStorage::TYPE_ALL);
-		m_aCurrentMapCrc[MAP_TYPE_SIX] = dfGeneratedMap.Crc();
-		m_aCurrentMapSha256[MAP_TYPE_SIX] = dfGeneratedMap.Sha256();
-		dfGeneratedMap.Close();
+	// take the map converted by PrepareMap() if it still matches the server map
+	std::shared_ptr<CMapPrepareJob> pJob = std::move(m_pMapPrepareJob);
+	std::unique_ptr<CClientMapData> pClientMap;
+	if(pJob && pJob->Done() && pJob->m_Success &&
+		str_comp(pJob->m_pClientMap->m_aMapName, pMapName) == 0 &&
+		str_comp(pJob->m_pClientMap->m_aConverterId, pConverterId) == 0 &&
+		pJob->m_pClientMap->m_ServerMapCrc == m_pMap->Crc())
+	{
+		pClientMap = std::move(pJob->m_pClientMap);
 	}
+	else
+	{
+		if(pJob && !pJob->Done())
+			m_pMapPrepareJob = std::move(pJob);
+
+		pClientMap = std::make_unique<CClientMapData>();
+		if(!ConvertClientMap(m_pEngine, Storage(), Console(), m_pMap, pMapName, pConverterId, Config()->m_InfConverterForceRegeneration, Config()->m_SvMapMmap, pClientMap.get()))
+			return false;
+	}
+
+	m_TimeShiftUnit = pClientMap->m_TimeShiftUnit;
+	m_aCurrentMapCrc[MAP_TYPE_SIX] = pClientMap->m_Crc;
+	m_aCurrentMapSha256[MAP_TYPE_SIX] = pClientMap->m_Sha256;
 
 	char aBufMsg[128];
 	char aSha256[SHA256_MAXSTRSIZE];
 	sha256_str(m_aCurrentMapSha256[MAP_TYPE_SIX], aSha256, sizeof(aSha256));
 	str_format(aBufMsg, sizeof(aBufMsg), "%s sha256 is %s", pMapName, aSha256);
 	Console()->Print(IConsole::OUTPUT_LEVEL_ADDINFO, "server", aBufMsg);
-	str_format(aBufMsg, sizeof(aBufMsg), "map crc is %08x, generated map crc is %08x", ServerMapCrc, m_aCurrentMapCrc[MAP_TYPE_SIX]);
+	str_format(aBufMsg, sizeof(aBufMsg), "map crc is %08x, generated map crc is %08x", pClientMap->m_ServerMapCrc, m_aCurrentMapCrc[MAP_TYPE_SIX]);
 	Console()->Print(IConsole::OUTPUT_LEVEL_ADDINFO, "server", aBufMsg);
 
-	// load complete map into memory for download
-	{
-		free(m_apCurrentMapData[MAP_TYPE_SIX]);
-		void *pData;
-		Storage()->ReadFile(aClientMapName, IStorage::TYPE_ALL, &pData, &m_aCurrentMapSize[MAP_TYPE_SIX]);
-		m_apCurrentMapData[MAP_TYPE_SIX] = (unsigned char *)pData;
-	}
+	m_apCurrentMapData[MAP_TYPE_SIX] = pClientMap->m_pData;
+	m_aCurrentMapSize[MAP_TYPE_SIX] = pClientMap->m_DataSize;
+	m_pCurrentClientMap = std::move(pClientMap);
 
 	return true;
 }
@@ -1820,6 +2182,7 @@ void CServer::ProcessClientPacket(CNetChunk *pPacket)
 				Console()->Print(IConsole::OUTPUT_LEVEL_ADDINFO, "server", aBuf);
 				m_aClients[ClientID].m_State = CClient::STATE_READY;
 				m_aClients[ClientID].m_WaitingTime = TickSpeed()*g_Config.m_InfConWaitingTime;
+				m_InputTrace.Join(ClientID, m_aClients[ClientID].m_Sixup, m_aClients[ClientID].m_DDNetVersion, m_aClients[ClientID].m_WaitingTime);
 			}
 		}
 		else if(Msg == NETMSG_ENTERGAME)
@@ -1833,6 +2196,7 @@ void CServer::ProcessClientPacket(CNetChunk *pPacket)
 				str_format(aBuf, sizeof(aBuf), "player has entered the game. ClientID=%d addr=%s", ClientID, aAddrStr);
 				Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "server", aBuf);
 				m_aClients[ClientID].m_State = CClient::STATE_INGAME;
+				m_InputTrace.Enter(ClientID);
 				
 				if(m_aClients[ClientID].m_WaitingTime <= 0)
 				{
@@ -1872,25 +2236,11 @@ void CServer::ProcessClientPacket(CNetChunk *pPacket)
 
 			m_aClients[ClientID].m_LastInputTick = IntendedTick;
 
-			CClient::CInput *pInput = &m_aClients[ClientID].m_aInputs[m_aClients[ClientID].m_CurrentInput];
-
-			if(IntendedTick <= Tick())
-				IntendedTick = Tick() + 1;
-
-			pInput->m_GameTick = IntendedTick;
-
+			int aData[MAX_INPUT_SIZE];
 			for(int i = 0; i < Size / 4; i++)
-				pInput->m_aData[i] = Unpacker.GetInt();
-
-			GameServer()->OnClientPrepareInput(ClientID, pInput->m_aData);
-			mem_copy(m_aClients[ClientID].m_LatestInput.m_aData, pInput->m_aData, MAX_INPUT_SIZE * sizeof(int));
-
-			m_aClients[ClientID].m_CurrentInput++;
-			m_aClients[ClientID].m_CurrentInput %= 200;
+				aData[i] = Unpacker.GetInt();
 
-			// call the mod with the fresh input data
-			if(m_aClients[ClientID].m_State == CClient::STATE_INGAME)
-				GameServer()->OnClientDirectInput(ClientID, m_aClients[ClientID].m_LatestInput.m_aData);
+			AddClientInput(ClientID, IntendedTick, aData, Size / 4);
 		}
 		else if(Msg == NETMSG_RCON_CMD)
 		{
@@ -2067,7 +2417,11 @@ void CServer::ProcessClientPacket(CNetChunk *pPacket)
 	{
 		// game message
 		if((pPacket->m_Flags & NET_CHUNKFLAG_VITAL) != 0 && m_aClients[ClientID].m_State >= CClient::STATE_READY)
+		{
+			if(m_InputTrace.IsRecording())
+				RecordInputTraceMessage(ClientID, Msg, Unpacker);
 			GameServer()->OnMessage(Msg, &Unpacker, ClientID);
+		}
 	}
 }
 
@@ -2775,6 +3129,8 @@ void CServer::PumpNetwork(bool PacketWaiting)
 	m_NetSession.Update();
 	m_NetAccusation.Update();
 	m_Econ.Update();
+
+	m_NetServer.Flush();
 }
 
 const char *CServer::GetMapName() const
@@ -2831,21 +3187,7 @@ int CServer::LoadMap(const char *pMapName)
 /* INFECTION MODIFICATION END *****************************************/
 
 	// stop recording when we change map
-	for(int i = 0; i < MAX_CLIENTS + 1; i++)
-	{
-		if(!m_aDemoRecorder[i].IsRecording())
-			continue;
-
-		m_aDemoRecorder[i].Stop();
-
-		// remove tmp demos
-		if(i < MAX_CLIENTS)
-		{
-			char aPath[256];
-			str_format(aPath, sizeof(aPath), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, i);
-			Storage()->RemoveFile(aPath, IStorage::TYPE_SAVE);
-		}
-	}
+	DemoRecorder_StopAll();
 
 	// reinit snapshot ids
 	m_IDPool.TimeoutIDs();
@@ -2860,9 +3202,187 @@ int CServer::LoadMap(const char *pMapName)
 	for(int i = 0; i < MAX_CLIENTS; i++)
 		m_aPrevStates[i] = m_aClients[i].m_State;
 
+	if(!m_Headless)
+		StartInputTrace();
+
 	return 1;
 }
 
+int CServer::StartHeadless()
+{
+	m_Headless = true;
+	m_RunServer = RUNNING;
+
+	for(CClient &Client : m_aClients)
+	{
+		Client.m_HasPersistentData = false;
+		Client.m_pPersistentData = nullptr;
+	}
+
+	if(!LoadMap(Config()->m_SvMap))
+	{
+		dbg_msg("server", "failed to load map. mapname='%s'", Config()->m_SvMap);
+		return -1;
+	}
+
+	GameServer()->OnInit();
+	if(ErrorShutdown())
+		return -1;
+
+	m_pConsole->StoreCommands(false);
+	m_GameStartTime = time_get();
+	return 0;
+}
+
+void CServer::TickHeadless()
+{
+	m_Profiler.SetEnabled(Config()->m_SvPerf);
+
+	DoTick();
+
+	if(Config()->m_SvHighBandwidth || (m_CurrentGameTick % 2) == 0)
+	{
+		CProfileScope Scope(&m_Profiler, m_ProfileScopeSnapshot);
+		DoSnapshot();
+	}
+}
+
+// The account chat commands are only kept with their name, their arguments hold the
+// credentials. A chat line may chain several commands.
+static bool RedactChatCommand(const char *pMessage, char *pRedacted, int Size)
+{
+	static const char *const s_apAccountCommands[] = {"login", "register", "setemail"};
+
+	pMessage = str_skip_whitespaces_const(pMessage);
+	if(pMessage[0] != '/')
+		return false;
+
+	bool Redact = false;
+	for(const char *pCommand = pMessage + 1; pCommand && !Redact; pCommand = str_find(pCommand, ";"))
+	{
+		if(*pCommand == ';')
+			pCommand++;
+		pCommand = str_skip_whitespaces_const(pCommand);
+		for(const char *pName : s_apAccountCommands)
+		{
+			const char *pEnd = str_startswith_nocase(pCommand, pName);
+			if(pEnd && (*pEnd == '\0' || *pEnd == ';' || *pEnd == ' ' || *pEnd == '\t'))
+				Redact = true;
+		}
+	}
+	if(!Redact)
+		return false;
+
+	int Length = 0;
+	while(pMessage[Length] && pMessage[Length] != ' ' && pMessage[Length] != '\t')
+		Length++;
+	str_truncate(pRedacted, Size, pMessage, Length);
+	return true;
+}
+
+void CServer::RecordInputTraceMessage(int ClientID, int Msg, CUnpacker Unpacker)
+{
+	const bool Sixup = m_aClients[ClientID].m_Sixup;
+	if(Msg == (Sixup ? (int)protocol7::NETMSGTYPE_CL_SAY : (int)NETMSGTYPE_CL_SAY))
+	{
+		const unsigned char *pData = Unpacker.RemainingData();
+		const int Size = Unpacker.RemainingSize();
+		const int Team = Unpacker.GetInt();
+		const int Target = Sixup ? Unpacker.GetInt() : 0;
+		const char *pMessage = Unpacker.GetString(0);
+		char aRedacted[64];
+		if(!Unpacker.Error() && RedactChatCommand(pMessage, aRedacted, sizeof(aRedacted)))
+		{
+			CPacker Packer;
+			Packer.Reset();
+			Packer.AddInt(Team);
+			if(Sixup)
+				Packer.AddInt(Target);
+			Packer.AddString(aRedacted, 0);
+			m_InputTrace.Message(ClientID, Msg, Packer.Data(), Packer.Size());
+			return;
+		}
+		m_InputTrace.Message(ClientID, Msg, pData, Size);
+		return;
+	}
+
+	m_InputTrace.Message(ClientID, Msg, Unpacker.RemainingData(), Unpacker.RemainingSize());
+}
+
+void CServer::StartInputTrace()
+{
+	m_InputTrace.Stop();
+	if(!Config()->m_SvInputTrace)
+		return;
+
+	char aDate[20];
+	char aFilename[IO_MAX_PATH_LENGTH];
+	str_timestamp(aDate, sizeof(aDate));
+	str_format(aFilename, sizeof(aFilename), "input_traces/%s_%s.trace", m_aCurrentMap, aDate);
+
+	// the game of the map is only replayable with the same random numbers
+	const unsigned Seed = secure_rand();
+	random_seed(Seed);
+
+	char aBuf[IO_MAX_PATH_LENGTH + 64];
+	if(!m_InputTrace.Start(Storage(), aFilename, m_aCurrentMap, m_pMap->Crc(), Seed))
+	{
+		str_format(aBuf, sizeof(aBuf), "failed to open '%s'", aFilename);
+		Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "input_trace", aBuf);
+		return;
+	}
+	str_format(aBuf, sizeof(aBuf), "recording to '%s'", aFilename);
+	Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "input_trace", aBuf);
+}
+
+int CServer::ReplayInputTrace(CInputTraceReader *pReader, int MaxTicks)
+{
+	int NumTicks = 0;
+	CInputTraceReader::CRecord Record;
+	while(NumTicks < MaxTicks && pReader->NextRecord(&Record))
+	{
+		const int ClientID = Record.m_ClientID;
+		switch(Record.m_Type)
+		{
+		case CInputTrace::RECORD_TICKS:
+			for(int i = 0; i < Record.m_NumTicks && NumTicks < MaxTicks; i++, NumTicks++)
+				TickHeadless();
+			break;
+		case CInputTrace::RECORD_JOIN:
+			// the replayed clients are bots, nothing is sent to them
+			m_aClients[ClientID].Reset();
+			m_aClients[ClientID].m_IsBot = true;
+			m_aClients[ClientID].m_Sixup = Record.m_Sixup;
+			m_aClients[ClientID].m_DDNetVersion = Record.m_DDNetVersion;
+			m_aClients[ClientID].m_State = CClient::STATE_READY;
+			m_aClients[ClientID].m_WaitingTime = Record.m_WaitingTime;
+			break;
+		case CInputTrace::RECORD_ENTER:
+			m_aClients[ClientID].m_State = CClient::STATE_INGAME;
+			if(m_aClients[ClientID].m_WaitingTime <= 0)
+				GameServer()->OnClientEnter(ClientID);
+			break;
+		case CInputTrace::RECORD_DROP:
+			DelClientCallback(ClientID, (EClientDropType)Record.m_DropType, Record.m_aReason, this);
+			break;
+		case CInputTrace::RECORD_INPUT:
+			AddClientInput(ClientID, Tick() + Record.m_TickOffset, Record.m_aInput, Record.m_Size);
+			break;
+		case CInputTrace::RECORD_MESSAGE:
+		{
+			CUnpacker Unpacker;
+			Unpacker.Reset(Record.m_pData, Record.m_Size);
+			GameServer()->OnMessage(Record.m_Msg, &Unpacker, ClientID);
+			break;
+		}
+		}
+	}
+
+	if(pReader->Error())
+		Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "input_trace", "the trace is corrupted, the replay stopped early");
+	return NumTicks;
+}
+
 static bool IsSeparator(char c) { return c == ';' || c == ' ' || c == ',' || c == '\t'; }
 
 int CServer::Run()
@@ -2986,14 +3506,15 @@ int CServer::Run()
 	if(Port == 0)
 		dbg_msg("server", "using port %d", BindAddr.port);
 
+	net_udp_set_send_batching(m_NetServer.Socket(), Config()->m_SvNetBatchSend);
+
 	if(!m_Http.Init(std::chrono::seconds{2}))
 	{
 		log_error("server", "Failed to initialize the HTTP client.");
 		return -1;
 	}
 
-	IEngine *pEngine = Kernel()->RequestInterface<IEngine>();
-	m_pRegister = CreateRegister(&g_Config, m_pConsole, pEngine, &m_Http, this->Port(), m_NetServer.GetGlobalToken());
+	m_pRegister = CreateRegister(&g_Config, m_pConsole, m_pEngine, &m_Http, this->Port(), m_NetServer.GetGlobalToken());
 
 	m_NetServer.SetCallbacks(NewClientCallback, NewClientNoAuthCallback, ClientRejoinCallback, DelClientCallback, this);
 
@@ -3030,8 +3551,13 @@ int CServer::Run()
 		UpdateServerInfo();
 		while(m_RunServer < STOPPING)
 		{
+			m_Profiler.SetEnabled(Config()->m_SvPerf);
+
 			if(NonActive)
+			{
+				CProfileScope Scope(&m_Profiler, m_ProfileScopeNetwork);
 				PumpNetwork(PacketWaiting);
+			}
 
 			set_new_tick();
 
@@ -3048,7 +3574,9 @@ int CServer::Run()
 #endif
 
 			// load new map TODO: don't poll this
-			if(str_comp(g_Config.m_SvMap, m_aCurrentMap) != 0 || m_MapReload || m_CurrentGameTick >= MAX_TICK) // force reload to make sure the ticks stay within a valid range
+			// the current map keeps running until the new one is converted in the background
+			if((str_comp(g_Config.m_SvMap, m_aCurrentMap) != 0 || m_MapReload || m_CurrentGameTick >= MAX_TICK) && // force reload to make sure the ticks stay within a valid range
+				!IsMapPreparing(Config()->m_SvMap))
 			{
 				// load map
 				if(LoadMap(Config()->m_SvMap))
@@ -3107,94 +3635,9 @@ int CServer::Run()
 
 			while(t > TickStartTime(m_CurrentGameTick+1))
 			{
-				for(int c = 0; c < MAX_CLIENTS; c++)
-				{
-					if(m_aClients[c].m_State != CClient::STATE_INGAME)
-						continue;
-					bool ClientHadInput = false;
-					for(auto &Input : m_aClients[c].m_aInputs)
-					{
-						if(Input.m_GameTick == Tick() + 1)
-						{
-							GameServer()->OnClientPredictedEarlyInput(c, Input.m_aData);
-							ClientHadInput = true;
-						}
-					}
-					if(!ClientHadInput)
-						GameServer()->OnClientPredictedEarlyInput(c, nullptr);
-				}
-
-				m_CurrentGameTick++;
+				DoTick();
 				NewTicks++;
 
-				//Check for name collision. We add this because the login is in a different thread and can't check it himself.
-				for(int i=MAX_CLIENTS-1; i>=0; i--)
-				{
-					if(m_aClients[i].m_State >= CClient::STATE_READY && m_aClients[i].m_Session.m_MuteTick > 0)
-						m_aClients[i].m_Session.m_MuteTick--;
-				}
-				
-				for(int ClientID=0; ClientID<MAX_CLIENTS; ClientID++)
-				{
-					if(m_aClients[ClientID].m_WaitingTime > 0)
-					{
-						m_aClients[ClientID].m_WaitingTime--;
-						if(m_aClients[ClientID].m_WaitingTime <= 0)
-						{
-							if(m_aClients[ClientID].m_State == CClient::STATE_READY)
-							{
-								void *pPersistentData = 0;
-								if(m_aClients[ClientID].m_HasPersistentData)
-								{
-									pPersistentData = m_aClients[ClientID].m_pPersistentData;
-									m_aClients[ClientID].m_HasPersistentData = false;
-								}
-
-								GameServer()->OnClientConnected(ClientID, pPersistentData);
-								SendConnectionReady(ClientID);
-							}
-							else if(m_aClients[ClientID].m_State == CClient::STATE_INGAME)
-							{
-								GameServer()->OnClientEnter(ClientID);
-							}
-						}
-					}
-				}
-
-				// apply new input
-				for(int c = 0; c < MAX_CLIENTS; c++)
-				{
-					if(m_aClients[c].m_State != CClient::STATE_INGAME)
-						continue;
-					bool ClientHadInput = false;
-					for(auto &Input : m_aClients[c].m_aInputs)
-					{
-						if(Input.m_GameTick == Tick())
-						{
-							GameServer()->OnClientPredictedInput(c, Input.m_aData);
-							ClientHadInput = true;
-							break;
-						}
-					}
-					if(!ClientHadInput)
-						GameServer()->OnClientPredictedInput(c, nullptr);
-				}
-
-				GameServer()->OnTick();
-				
-#ifdef CONF_SQL
-				if(m_lGameServerCmds.size())
-				{
-					lock_wait(m_GameServerCmdLock);
-					for(int i=0; i<m_lGameServerCmds.size(); i++)
-					{
-						m_lGameServerCmds[i]->Execute(GameServer());
-						delete m_lGameServerCmds[i];
-					}
-					m_lGameServerCmds.clear();
-					lock_release(m_GameServerCmdLock);
-				} 
-#endif
 				if(ErrorShutdown())
 				{
 					break;
@@ -3205,9 +3648,19 @@ int CServer::Run()
 			if(NewTicks)
 			{
 				if(Config()->m_SvHighBandwidth || (m_CurrentGameTick % 2) == 0)
+				{
+					CProfileScope Scope(&m_Profiler, m_ProfileScopeSnapshot);
 					DoSnapshot();
+					m_NetServer.Flush();
+				}
 
 				UpdateClientRconCommands();
+
+				if(Config()->m_SvPerfEconInterval && time_get() > m_LastPerfEconTime + Config()->m_SvPerfEconInterval * time_freq())
+				{
+					m_LastPerfEconTime = time_get();
+					SendPerfEcon();
+				}
 			}
 
 			// master server stuff
@@ -3217,7 +3670,10 @@ int CServer::Run()
 				UpdateServerInfo();
 
 			if(!NonActive)
+			{
+				CProfileScope Scope(&m_Profiler, m_ProfileScopeNetwork);
 				PumpNetwork(PacketWaiting);
+			}
 
 			for(int i = 0; i < MAX_CLIENTS; ++i)
 			{
@@ -3240,6 +3696,8 @@ int CServer::Run()
 				}
 			}
 
+			m_NetServer.Flush();
+
 			// wait for incoming data
 			if(NonActive)
 			{
@@ -3303,6 +3761,17 @@ int CServer::Run()
 	GameServer()->OnShutdown();
 	m_pMap->Unload();
 
+	// finish the demos, the writer thread drains its queue before it exits
+	DemoRecorder_StopAll();
+	m_pDemoWriter = nullptr;
+	m_InputTrace.Stop();
+
+	// the background map conversions use the storage and the console
+	for(auto &pJob : m_vpMapPrepareJobs)
+		pJob->WaitFinished();
+	m_vpMapPrepareJobs.clear();
+	m_pMapPrepareJob = nullptr;
+
 /* DDNET MODIFICATION START *******************************************/
 #ifdef CONF_SQL
 	for (int i = 0; i < MAX_SQLSERVERS; i++)
@@ -3414,6 +3883,118 @@ void CServer::ConStatusExtended(IConsole::IResult *pResult, void *pUser)
 	ConStatus(pResult, pUser);
 }
 
+void CServer::ConNetStats(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	NETSTATS Stats;
+	net_stats(&Stats);
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "sent %" PRIu64 " packets (%" PRIu64 " bytes), received %" PRIu64 " packets (%" PRIu64 " bytes)",
+		Stats.sent_packets, Stats.sent_bytes, Stats.recv_packets, Stats.recv_bytes);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "net", aBuf);
+	str_format(aBuf, sizeof(aBuf), "send syscalls saved by batching: %" PRIu64, Stats.sent_syscalls_saved);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "net", aBuf);
+}
+
+void CServer::ConDemoStats(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	if(!pThis->m_pDemoWriter)
+	{
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", "the demo writer thread is not running");
+		return;
+	}
+
+	CDemoRecordWriter::CStats Stats;
+	pThis->m_pDemoWriter->GetStats(&Stats);
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "queued %" PRIu64 " chunks (%" PRIu64 " bytes), written %" PRIu64 ", dropped %" PRIu64,
+		Stats.m_QueuedChunks, Stats.m_QueuedBytes, Stats.m_WrittenChunks, Stats.m_DroppedChunks);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", aBuf);
+	str_format(aBuf, sizeof(aBuf), "queue usage %d/%d bytes (peak %d), blocked %" PRIu64 " times for %.2fms",
+		Stats.m_QueueUsage, Stats.m_QueueSize, Stats.m_QueuePeak, Stats.m_BlockedPushes, Stats.m_BlockedTime * 1000.0 / time_freq());
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", aBuf);
+}
+
+void CServer::ConPerfDump(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	const CProfiler &Profiler = pThis->m_Profiler;
+
+	CProfiler::CStats Stats;
+	Profiler.GetTotalStats(&Stats);
+
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "%d ticks, %d over budget%s", Profiler.NumSamples(), Profiler.NumOverruns(), Profiler.IsEnabled() ? "" : " (disabled)");
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", aBuf);
+	str_format(aBuf, sizeof(aBuf), "%-24s p50=%.3fms p99=%.3fms max=%.3fms avg=%.3fms", "total",
+		Stats.m_P50 / 1000000.0, Stats.m_P99 / 1000000.0, Stats.m_Max / 1000000.0, Stats.m_Avg / 1000000.0);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", aBuf);
+
+	Profiler.ForEachScope([&](int Scope) {
+		char aName[64];
+		str_format(aName, sizeof(aName), "%*s%s", 2 * (Profiler.ScopeDepth(Scope) + 1), "", Profiler.ScopeName(Scope));
+		Profiler.GetStats(Scope, &Stats);
+		str_format(aBuf, sizeof(aBuf), "%-24s p50=%.3fms p99=%.3fms max=%.3fms avg=%.3fms", aName,
+			Stats.m_P50 / 1000000.0, Stats.m_P99 / 1000000.0, Stats.m_Max / 1000000.0, Stats.m_Avg / 1000000.0);
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", aBuf);
+	});
+}
+
+void CServer::ConPerfReset(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	pThis->m_Profiler.Reset();
+}
+
+void CServer::ConPerfTrace(IConsole::IResult *pResult, void *pUser)
+{
+	CServer *pThis = static_cast<CServer *>(pUser);
+	if(pResult->NumArguments() == 0)
+	{
+		if(pThis->m_Profiler.IsTracing())
+		{
+			pThis->m_Profiler.StopTrace();
+			pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", "trace stopped");
+		}
+		return;
+	}
+
+	const char *pFilename = pResult->GetString(0);
+	char aBuf[IO_MAX_PATH_LENGTH + 64];
+	if(!pThis->m_Profiler.StartTrace(pThis->Storage()->OpenFile(pFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE), pThis->Config()->m_SvPerfTraceTicks))
+	{
+		str_format(aBuf, sizeof(aBuf), "failed to open '%s'", pFilename);
+		pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", aBuf);
+		return;
+	}
+	str_format(aBuf, sizeof(aBuf), "tracing %d ticks to '%s'", pThis->Config()->m_SvPerfTraceTicks, pFilename);
+	pThis->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "perf", aBuf);
+}
+
+void CServer::SendPerfEcon()
+{
+	if(!m_Profiler.NumSamples())
+		return;
+
+	CProfiler::CStats Stats;
+	m_Profiler.GetTotalStats(&Stats);
+
+	char aBuf[512];
+	str_format(aBuf, sizeof(aBuf), "perf: total p50=%.3f p99=%.3f max=%.3f overruns=%d", Stats.m_P50 / 1000000.0, Stats.m_P99 / 1000000.0, Stats.m_Max / 1000000.0, m_Profiler.NumOverruns());
+	m_Profiler.ForEachScope([&](int Scope) {
+		if(m_Profiler.ScopeParent(Scope) >= 0)
+			return;
+		m_Profiler.GetStats(Scope, &Stats);
+		char aScope[64];
+		str_format(aScope, sizeof(aScope), " %s=%.3f/%.3f", m_Profiler.ScopeName(Scope), Stats.m_P50 / 1000000.0, Stats.m_P99 / 1000000.0);
+		str_append(aBuf, aScope, sizeof(aBuf));
+	});
+	m_Econ.Send(-1, aBuf);
+}
+
 void CServer::ConStatus(IConsole::IResult *pResult, void *pUser)
 {
 	char aBuf[1024];
@@ -3537,12 +4118,12 @@ void CServer::DemoRecorder_HandleAutoStart()
 {
 	if(Config()->m_SvAutoDemoRecord)
 	{
-		m_aDemoRecorder[0].Stop();
+		m_aDemoRecorder[0].Stop(IDemoRecorder::EStopMode::KEEP_FILE);
 		char aFilename[IO_MAX_PATH_LENGTH];
 		char aDate[20];
 		str_timestamp(aDate, sizeof(aDate));
 		str_format(aFilename, sizeof(aFilename), "demos/%s_%s.demo", "auto/autorecord", aDate);
-		m_aDemoRecorder[0].Start(Storage(), m_pConsole, aFilename, GameServer()->NetVersion(), m_aCurrentMap, &m_aCurrentMapSha256[MAP_TYPE_SIX], m_aCurrentMapCrc[MAP_TYPE_SIX], "server", m_aCurrentMapSize[MAP_TYPE_SIX], m_apCurrentMapData[MAP_TYPE_SIX]);
+		DemoRecorder_Start(0, aFilename);
 		if(Config()->m_SvAutoDemoMax)
 		{
 			// clean up auto recorded demos
@@ -3552,18 +4133,55 @@ void CServer::DemoRecorder_HandleAutoStart()
 	}
 }
 
+int CServer::DemoRecorder_Start(int Recorder, const char *pFilename)
+{
+	// the recorder keeps the writer it was started with until it is stopped
+	if(!m_aDemoRecorder[Recorder].IsRecording())
+	{
+		if(Config()->m_SvDemoAsync && !m_pDemoWriter)
+			m_pDemoWriter = std::make_unique<CDemoRecordWriter>(Config()->m_SvDemoQueueSize * 1024);
+		if(m_pDemoWriter)
+			m_pDemoWriter->SetPolicy(Config()->m_SvDemoQueuePolicy);
+		m_aDemoRecorder[Recorder].SetWriter(Config()->m_SvDemoAsync ? m_pDemoWriter.get() : nullptr);
+	}
+	return m_aDemoRecorder[Recorder].Start(Storage(), Console(), pFilename, GameServer()->NetVersion(), m_aCurrentMap, &m_aCurrentMapSha256[MAP_TYPE_SIX], m_aCurrentMapCrc[MAP_TYPE_SIX], "server", m_aCurrentMapSize[MAP_TYPE_SIX], m_apCurrentMapData[MAP_TYPE_SIX]);
+}
+
+void CServer::DemoRecorder_StopPlayer(int ClientID, IDemoRecorder::EStopMode Mode, const char *pTargetFilename)
+{
+	// only the temporary player demo is removed or renamed, the recorder may
+	// also be recording the server demo
+	if(!m_aaPlayerDemoTmpFilename[ClientID][0] || str_comp(m_aDemoRecorder[ClientID].GetCurrentFilename(), m_aaPlayerDemoTmpFilename[ClientID]) != 0)
+	{
+		Mode = IDemoRecorder::EStopMode::KEEP_FILE;
+		pTargetFilename = "";
+	}
+	m_aDemoRecorder[ClientID].Stop(Mode, pTargetFilename);
+}
+
+void CServer::DemoRecorder_StopAll()
+{
+	for(int i = 0; i < MAX_CLIENTS + 1; i++)
+	{
+		if(!m_aDemoRecorder[i].IsRecording())
+			continue;
+
+		// remove tmp demos
+		if(i < MAX_CLIENTS)
+			DemoRecorder_StopPlayer(i, IDemoRecorder::EStopMode::REMOVE_FILE);
+		else
+			m_aDemoRecorder[i].Stop(IDemoRecorder::EStopMode::KEEP_FILE);
+	}
+}
+
 void CServer::SaveDemo(int ClientID, float Time)
 {
 	if(IsRecording(ClientID))
 	{
-		m_aDemoRecorder[ClientID].Stop();
-
 		// rename the demo
-		char aOldFilename[IO_MAX_PATH_LENGTH];
 		char aNewFilename[IO_MAX_PATH_LENGTH];
-		str_format(aOldFilename, sizeof(aOldFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
 		str_format(aNewFilename, sizeof(aNewFilename), "demos/%s_%s_%05.2f.demo", m_aCurrentMap, m_aClients[ClientID].m_aName, Time);
-		Storage()->RenameFile(aOldFilename, aNewFilename, IStorage::TYPE_SAVE);
+		DemoRecorder_StopPlayer(ClientID, IDemoRecorder::EStopMode::KEEP_FILE, aNewFilename);
 	}
 }
 
@@ -3571,22 +4189,16 @@ void CServer::StartRecord(int ClientID)
 {
 	if(Config()->m_SvPlayerDemoRecord)
 	{
-		char aFilename[IO_MAX_PATH_LENGTH];
-		str_format(aFilename, sizeof(aFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
-		m_aDemoRecorder[ClientID].Start(Storage(), Console(), aFilename, GameServer()->NetVersion(), m_aCurrentMap, &m_aCurrentMapSha256[MAP_TYPE_SIX], m_aCurrentMapCrc[MAP_TYPE_SIX], "server", m_aCurrentMapSize[MAP_TYPE_SIX], m_apCurrentMapData[MAP_TYPE_SIX]);
+		char *pFilename = m_aaPlayerDemoTmpFilename[ClientID];
+		str_format(pFilename, IO_MAX_PATH_LENGTH, "demos/%s_%d_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID, m_NumPlayerDemos++);
+		DemoRecorder_Start(ClientID, pFilename);
 	}
 }
 
 void CServer::StopRecord(int ClientID)
 {
 	if(IsRecording(ClientID))
-	{
-		m_aDemoRecorder[ClientID].Stop();
-
-		char aFilename[IO_MAX_PATH_LENGTH];
-		str_format(aFilename, sizeof(aFilename), "demos/%s_%d_%d_tmp.demo", m_aCurrentMap, m_NetServer.Address().port, ClientID);
-		Storage()->RemoveFile(aFilename, IStorage::TYPE_SAVE);
-	}
+		DemoRecorder_StopPlayer(ClientID, IDemoRecorder::EStopMode::REMOVE_FILE);
 }
 
 bool CServer::IsRecording(int ClientID)
@@ -3607,12 +4219,12 @@ void CServer::ConRecord(IConsole::IResult *pResult, void *pUser)
 		str_timestamp(aDate, sizeof(aDate));
 		str_format(aFilename, sizeof(aFilename), "demos/demo_%s.demo", aDate);
 	}
-	pServer->m_aDemoRecorder[0].Start(pServer->Storage(), pServer->Console(), aFilename, pServer->GameServer()->NetVersion(), pServer->m_aCurrentMap, &pServer->m_aCurrentMapSha256[MAP_TYPE_SIX], pServer->m_aCurrentMapCrc[MAP_TYPE_SIX], "server", pServer->m_aCurrentMapSize[MAP_TYPE_SIX], pServer->m_apCurrentMapData[MAP_TYPE_SIX]);
+	pServer->DemoRecorder_Start(0, aFilename);
 }
 
 void CServer::ConStopRecord(IConsole::IResult *pResult, void *pUser)
 {
-	((CServer *)pUser)->m_aDemoRecorder[0].Stop();
+	((CServer *)pUser)->m_aDemoRecorder[0].Stop(IDemoRecorder::EStopMode::KEEP_FILE);
 }
 
 void CServer::ConMapReload(IConsole::IResult *pResult, void *pUser)
@@ -3897,6 +4509,14 @@ void CServer::ConchainMapUpdate(IConsole::IResult *pResult, void *pUserData, ICo
 	}
 }
 
+void CServer::ConchainNetBatchSend(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData)
+{
+	pfnCallback(pResult, pCallbackUserData);
+	CServer *pThis = static_cast<CServer *>(pUserData);
+	if(pResult->NumArguments() && pThis->m_NetServer.Socket())
+		net_udp_set_send_batching(pThis->m_NetServer.Socket(), pThis->Config()->m_SvNetBatchSend);
+}
+
 void CServer::ConchainSixupUpdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData)
 {
 	pfnCallback(pResult, pCallbackUserData);
@@ -3959,12 +4579,14 @@ void CServer::RegisterCommands()
 	m_pGameServer = Kernel()->RequestInterface<IGameServer>();
 	m_pMap = Kernel()->RequestInterface<IEngineMap>();
 	m_pStorage = Kernel()->RequestInterface<IStorage>();
+	m_pEngine = Kernel()->RequestInterface<IEngine>();
 
 	Kernel()->RegisterInterface(static_cast<IHttp *>(&m_Http), false);
 
 	// register console commands
 	Console()->Register("kick", "i[id] ?r[reason]", CFGFLAG_SERVER, ConKick, this, "Kick player with specified id for any reason");
 	Console()->Register("status", "?r[name]", CFGFLAG_SERVER, ConStatus, this, "List players containing name or all players");
+	Console()->Register("net_stats", "", CFGFLAG_SERVER, ConNetStats, this, "Show the network traffic counters");
 	Console()->Register("shutdown", "?r[reason]", CFGFLAG_SERVER, ConShutdown, this, "Shut down");
 	Console()->Register("shutdown2", "?r[reason]", CFGFLAG_SERVER, ConShutdown2, this, "Shut down and reconnect clients");
 	Console()->Register("logout", "", CFGFLAG_SERVER, ConLogout, this, "Logout of rcon");
@@ -3972,6 +4594,10 @@ void CServer::RegisterCommands()
 
 	Console()->Register("record", "?s[file]", CFGFLAG_SERVER | CFGFLAG_STORE, ConRecord, this, "Record to a file");
 	Console()->Register("stoprecord", "", CFGFLAG_SERVER, ConStopRecord, this, "Stop recording");
+	Console()->Register("demo_stats", "", CFGFLAG_SERVER, ConDemoStats, this, "Show the demo writer queue counters");
+	Console()->Register("perf_dump", "", CFGFLAG_SERVER, ConPerfDump, this, "Show the tick phase timings of the last ticks");
+	Console()->Register("perf_reset", "", CFGFLAG_SERVER, ConPerfReset, this, "Reset the tick phase timings");
+	Console()->Register("perf_trace", "?s[file]", CFGFLAG_SERVER, ConPerfTrace, this, "Write a chrome://tracing file of the next sv_perf_trace_ticks ticks, stop without a file");
 
 	Console()->Register("reload", "", CFGFLAG_SERVER, ConMapReload, this, "Reload the map");
 
@@ -3991,6 +4617,7 @@ void CServer::RegisterCommands()
 
 	Console()->Chain("sv_map", ConchainMapUpdate, this);
 	Console()->Chain("sv_sixup", ConchainSixupUpdate, this);
+	Console()->Chain("sv_net_batch_send", ConchainNetBatchSend, this);
 
 	Console()->Chain("loglevel", ConchainLoglevel, this);
 	Console()->Chain("stdout_output_level", ConchainStdoutOutputLevel, this);
@@ -4038,7 +4665,26 @@ void *CServer::SnapNewItem(int Type, int ID, int Size)
 
 void CServer::SnapSetStaticsize(int ItemType, int Size)
 {
+	// the 0.7 event items override the static sizes of the 0.6 ones with the same type index
+	if(ItemType == protocol7::NETEVENTTYPE_SOUNDWORLD || ItemType == protocol7::NETEVENTTYPE_DAMAGE)
+		return;
 	m_SnapshotDelta.SetStaticsize(ItemType, Size);
+	m_SnapshotDeltaSixup.SetStaticsize(ItemType, Size);
+}
+
+void CServer::SnapStartRecording()
+{
+	m_SnapshotBuilder.StartRecording();
+}
+
+void CServer::SnapStopRecording(CSnapshotItemRecord *pRecord)
+{
+	m_SnapshotBuilder.StopRecording(pRecord);
+}
+
+void CServer::SnapAddRecord(const CSnapshotItemRecord &Record)
+{
+	m_SnapshotBuilder.AddRecord(Record);
 }
 
 int CServer::GetClientInfclassVersion(int ClientID) const
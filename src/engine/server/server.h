@@ -13,15 +13,20 @@
 #include <engine/server/netsession.h>
 #include <engine/server/register.h>
 #include <engine/server/roundstatistics.h>
+#include <engine/shared/datafile.h>
 #include <engine/shared/demo.h>
 #include <engine/shared/econ.h>
 #include <engine/shared/http.h>
+#include <engine/shared/inputtrace.h>
 #include <engine/shared/netban.h>
 #include <engine/shared/network.h>
+#include <engine/shared/profiler.h>
 #include <engine/shared/snapshot.h>
 #include <game/voting.h>
 
 #include <list>
+#include <memory>
+#include <vector>
 
 /* DDNET MODIFICATION START *******************************************/
 #include "base/logger.h"
@@ -100,6 +105,7 @@ class CServer : public IServer
 	class CConfig *m_pConfig;
 	class IConsole *m_pConsole;
 	class IStorage *m_pStorage;
+	class IEngine *m_pEngine;
 	class IRegister *m_pRegister;
 
 #if defined(CONF_UPNP)
@@ -228,6 +234,7 @@ public:
 	int m_aIdMap[MAX_CLIENTS * VANILLA_MAX_CLIENTS];
 
 	CSnapshotDelta m_SnapshotDelta;
+	CSnapshotDelta m_SnapshotDeltaSixup;
 	CSnapshotBuilder m_SnapshotBuilder;
 	CSnapIDPool m_IDPool;
 	CNetServer m_NetServer;
@@ -281,6 +288,30 @@ public:
 	unsigned int m_aCurrentMapSize[NUM_MAP_TYPES];
 
 	CDemoRecorder m_aDemoRecorder[NUM_RECORDERS];
+	std::unique_ptr<CDemoRecordWriter> m_pDemoWriter;
+	// the writer thread may still close, remove or rename the previous
+	// temporary demo of a client, so every recording gets its own file
+	int m_NumPlayerDemos;
+	char m_aaPlayerDemoTmpFilename[MAX_CLIENTS][IO_MAX_PATH_LENGTH];
+
+	CProfiler m_Profiler;
+	int m_ProfileScopeInput;
+	int m_ProfileScopeGame;
+	int m_ProfileScopeSql;
+	int m_ProfileScopeSnapshot;
+	int m_ProfileScopeSnap;
+	int m_ProfileScopeDelta;
+	int m_ProfileScopeSend;
+	int m_ProfileScopeNetwork;
+	int64_t m_LastPerfEconTime;
+
+	// headless mode of the benchmark: there is no network, the snapshots of
+	// the bots are built and counted instead of being sent
+	bool m_Headless;
+	int m_aHeadlessSnapshots[MAX_CLIENTS];
+	int64_t m_aHeadlessSnapshotBytes[MAX_CLIENTS];
+
+	CInputTraceWriter m_InputTrace;
 
 	int64_t m_ServerInfoFirstRequest;
 	int m_ServerInfoNumRequests;
@@ -314,6 +345,9 @@ public:
 	void RedirectClient(int ClientID, int Port, bool Verbose = false) override;
 
 	void DemoRecorder_HandleAutoStart() override;
+	int DemoRecorder_Start(int Recorder, const char *pFilename);
+	void DemoRecorder_StopPlayer(int ClientID, IDemoRecorder::EStopMode Mode, const char *pTargetFilename = "");
+	void DemoRecorder_StopAll();
 
 	//int Tick()
 	int64_t TickStartTime(int Tick);
@@ -341,7 +375,25 @@ public:
 	int GetClientVersion(int ClientID) const override;
 	int SendMsg(CMsgPacker *pMsg, int Flags, int ClientID) override;
 
+	// Per-client scratch space for snapshots which are delta'd and compressed on the job pool
+	class CSnapshotSlot
+	{
+	public:
+		char m_aData[CSnapshot::MAX_SIZE];
+		char m_aCompData[CSnapshot::MAX_SIZE];
+		const CSnapshot *m_pDeltashot;
+		int m_DeltaTick;
+		int m_Crc;
+		int m_CompSize;
+	};
+	std::unique_ptr<CSnapshotSlot> m_apSnapshotSlots[MAX_CLIENTS];
+	SEMAPHORE m_SnapshotJobsDone;
+
+	const CSnapshotDelta *SnapshotDelta(int ClientID) const { return m_aClients[ClientID].m_Sixup ? &m_SnapshotDeltaSixup : &m_SnapshotDelta; }
+	void SendSnapshot(int ClientID, int Crc, int DeltaTick, const char *pCompData, int CompSize);
 	void DoSnapshot();
+	void AddClientInput(int ClientID, int IntendedTick, const int *pData, int Num);
+	void DoTick();
 
 	int NewBot(int ClientID) override;
 	int DelBot(int ClientID) override;
@@ -408,6 +460,8 @@ public:
 
 	bool GetMapReload() const override { return m_MapReload; }
 	void ChangeMap(const char *pMap) override;
+	void PrepareMap(const char *pMap) override;
+	bool IsMapPreparing(const char *pMapName);
 	const char *GetMapName() const override;
 	int LoadMap(const char *pMapName);
 
@@ -417,9 +471,21 @@ public:
 	bool IsRecording(int ClientID) override;
 
 	int Run();
+	// used by the benchmark instead of Run(), see src/tools/bench_server.cpp
+	int StartHeadless();
+	void TickHeadless();
+	void StartInputTrace();
+	void RecordInputTraceMessage(int ClientID, int Msg, CUnpacker Unpacker);
+	// returns the number of ticks replayed
+	int ReplayInputTrace(CInputTraceReader *pReader, int MaxTicks);
 
 	static void ConKick(IConsole::IResult *pResult, void *pUser);
 	static void ConStatus(IConsole::IResult *pResult, void *pUser);
+	static void ConNetStats(IConsole::IResult *pResult, void *pUser);
+	static void ConDemoStats(IConsole::IResult *pResult, void *pUser);
+	static void ConPerfDump(IConsole::IResult *pResult, void *pUser);
+	static void ConPerfReset(IConsole::IResult *pResult, void *pUser);
+	static void ConPerfTrace(IConsole::IResult *pResult, void *pUser);
 	static void ConStatusExtended(IConsole::IResult *pResult, void *pUser);
 	static void ConShutdown(IConsole::IResult *pResult, void *pUser);
 	static void ConShutdown2(IConsole::IResult *pResult, void *pUser);
@@ -456,6 +522,7 @@ public:
 	static void ConchainRconModPasswordChange(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainRconHelperPasswordChange(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainMapUpdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
+	static void ConchainNetBatchSend(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainSixupUpdate(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainLoglevel(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
 	static void ConchainStdoutOutputLevel(IConsole::IResult *pResult, void *pUserData, IConsole::FCommandCallback pfnCallback, void *pCallbackUserData);
@@ -470,6 +537,9 @@ public:
 	void SnapFreeID(int ID) override;
 	void *SnapNewItem(int Type, int ID, int Size) override;
 	void SnapSetStaticsize(int ItemType, int Size) override;
+	void SnapStartRecording() override;
+	void SnapStopRecording(CSnapshotItemRecord *pRecord) override;
+	void SnapAddRecord(const CSnapshotItemRecord &Record) override;
 
 	// DDRace
 
@@ -481,6 +551,8 @@ public:
 
 	bool ClientPrevIngame(int ClientID) override { return m_aPrevStates[ClientID] == CClient::STATE_INGAME; }
 	const char *GetNetErrorString(int ClientID) override { return m_NetServer.ErrorString(ClientID); }
+	CProfiler *Profiler() override { return &m_Profiler; }
+	void SendPerfEcon();
 	void ResetNetErrorString(int ClientID) override { m_NetServer.ResetErrorString(ClientID); }
 	bool SetTimedOut(int ClientID, int OrigID) override;
 	void SetTimeoutProtected(int ClientID) override { m_NetServer.SetTimeoutProtected(ClientID); }
@@ -539,8 +611,42 @@ public:
 	void Login(int ClientID, const char* pUsername, const char* pPassword) override;
 	void Logout(int ClientID) override;
 #endif
+	// The converted client map, before it becomes the current map
+	class CClientMapData
+	{
+	public:
+		// set by the job which prepares the map
+		char m_aMapName[IO_MAX_PATH_LENGTH] = "";
+		char m_aConverterId[64] = "";
+		unsigned m_ServerMapCrc = 0;
+		unsigned m_Crc = 0;
+		SHA256_DIGEST m_Sha256;
+		unsigned char *m_pData = nullptr;
+		unsigned m_DataSize = 0;
+		int m_TimeShiftUnit = 0;
+		// keeps the client map mapped while m_pData points into it
+		CDataFileReader m_ClientMapFile;
+		bool m_DataMapped = false;
+
+		~CClientMapData()
+		{
+			if(!m_DataMapped)
+				free(m_pData);
+		}
+	};
+
+	// Thread safe, only uses the given map, storage and console
+	static bool ConvertClientMap(IEngine *pEngine, IStorage *pStorage, IConsole *pConsole, IEngineMap *pMap, const char *pMapName, const char *pConverterId, bool ForceRegeneration, bool Mapped, CClientMapData *pOut);
+
 private:
 	bool GenerateClientMap(const char *pMapFilePath, const char *pMapName);
+
+	// The map which is converted on the job pool by PrepareMap()
+	std::shared_ptr<class CMapPrepareJob> m_pMapPrepareJob;
+	// Every submitted conversion which may still be running, including the replaced ones
+	std::vector<std::shared_ptr<class CMapPrepareJob>> m_vpMapPrepareJobs;
+	// Owns m_apCurrentMapData[MAP_TYPE_SIX]
+	std::unique_ptr<CClientMapData> m_pCurrentClientMap;
 	
 public:
 	class CGameServerCmd
@@ -39,6 +39,13 @@ MACRO_CONFIG_INT(SvRconVote, sv_rcon_vote, 0, 0, 1, CFGFLAG_SERVER, "Only allow
 
 MACRO_CONFIG_INT(SvPlayerDemoRecord, sv_player_demo_record, 0, 0, 1, CFGFLAG_SERVER, "Automatically record demos for each player")
 MACRO_CONFIG_INT(SvDemoChat, sv_demo_chat, 0, 0, 1, CFGFLAG_SERVER, "Record chat for demos")
+MACRO_CONFIG_INT(SvDemoAsync, sv_demo_async, 1, 0, 1, CFGFLAG_SERVER, "Compress and write the demos on a separate thread (takes effect for the next recording)")
+MACRO_CONFIG_INT(SvDemoQueueSize, sv_demo_queue_size, 16384, 256, 1048576, CFGFLAG_SERVER, "Size of the demo writer queue in KiB (takes effect when the writer thread starts)")
+MACRO_CONFIG_INT(SvDemoQueuePolicy, sv_demo_queue_policy, 0, 0, 1, CFGFLAG_SERVER, "What to do when the demo writer queue is full (0 = wait for the writer, 1 = drop the snapshot or message)")
+MACRO_CONFIG_INT(SvPerf, sv_perf, 1, 0, 1, CFGFLAG_SERVER, "Measure the time spent in the phases of the server tick (see perf_dump)")
+MACRO_CONFIG_INT(SvPerfEconInterval, sv_perf_econ_interval, 0, 0, 3600, CFGFLAG_SERVER, "Send the tick phase times to the econ clients every that many seconds (0 = off)")
+MACRO_CONFIG_INT(SvPerfTraceTicks, sv_perf_trace_ticks, 500, 1, 100000, CFGFLAG_SERVER, "Number of ticks written by perf_trace before it stops")
+MACRO_CONFIG_INT(SvInputTrace, sv_input_trace, 0, 0, 1, CFGFLAG_SERVER, "Record the client inputs of every map to input_traces/, for bench_server -r (applies at the next map load)")
 MACRO_CONFIG_INT(SvServerInfoPerSecond, sv_server_info_per_second, 10, 1, 1000, CFGFLAG_SERVER, "Maximum number of complete server info responses that are sent out per second")
 MACRO_CONFIG_INT(SvVanConnPerSecond, sv_van_conn_per_second, 10, 0, 10000, CFGFLAG_SERVER, "Antispoof specific ratelimit (0 for no limit)")
 MACRO_CONFIG_INT(SvSixup, sv_sixup, 0, 0, 1, CFGFLAG_SERVER, "Enable sixup connections")
@@ -139,6 +146,10 @@ MACRO_CONFIG_INT(SvFilterChatCommands, sv_filter_chat_commands, 0, 0, 1, CFGFLAG
 MACRO_CONFIG_INT(SvSuggestMoreRounds, sv_suggest_more_rounds, 0, 0, 100, CFGFLAG_SERVER, "The number of extra rounds to be played on the suggestion (vote) accepted")
 MACRO_CONFIG_STR(SvChangeLogFile, sv_changelog_file, 128, "ChangeLog.txt", CFGFLAG_SERVER, "File with changelog entities")
 MACRO_CONFIG_INT(SvChangeLogMaxLinesPerPage, sv_changelog_lines_page, 6, 1, 64, CFGFLAG_SERVER, "File with changelog entities")
+MACRO_CONFIG_INT(SvMapMmap, sv_map_mmap, 1, 0, 1, CFGFLAG_SERVER, "Memory map the map files instead of reading them (don't overwrite a map file in place while it's in use)")
+MACRO_CONFIG_INT(SvMapBackgroundLoad, sv_map_background_load, 1, 0, 1, CFGFLAG_SERVER, "Convert and load the next map on a worker thread while the current map keeps running")
+MACRO_CONFIG_INT(SvParallelSnapshots, sv_parallel_snapshots, 0, 0, 1, CFGFLAG_SERVER, "Delta and compress the client snapshots on the job pool")
+MACRO_CONFIG_INT(SvNetBatchSend, sv_net_batch_send, 1, 0, 1, CFGFLAG_SERVER, "Queue the outgoing packets and send them together once per network update (Linux only)")
 
 #include "game/server/infclass/infc_config_variables.h"
 
@@ -583,7 +583,7 @@ int CConsole::PossibleCommands(const char *pStr, int FlagMask, bool Temp, FPossi
 
 CConsole::CCommand *CConsole::FindCommand(const char *pName, int FlagMask)
 {
-	for(CCommand *pCommand = m_pFirstCommand; pCommand; pCommand = pCommand->m_pNext)
+	for(CCommand *pCommand = m_apCommandHash[CommandHash(pName)]; pCommand; pCommand = pCommand->m_pNextHash)
 	{
 		if(pCommand->m_Flags & FlagMask)
 		{
@@ -1053,6 +1053,7 @@ CConsole::CConsole(int FlagMask)
 	m_apStrokeStr[1] = "1";
 	m_ExecutionQueue.Reset();
 	m_pFirstCommand = 0;
+	mem_zero(m_apCommandHash, sizeof(m_apCommandHash));
 	m_pFirstExec = 0;
 	mem_zero(m_aPrintCB, sizeof(m_aPrintCB));
 	m_NumPrintCB = 0;
@@ -1169,14 +1170,25 @@ void CConsole::ParseArguments(int NumArgs, const char **ppArguments)
 	}
 }
 
+unsigned CConsole::CommandHash(const char *pName)
+{
+	// FNV-1a over the ASCII lowercase name, matching str_comp_nocase
+	unsigned Hash = 2166136261u;
+	for(; *pName; pName++)
+	{
+		unsigned char c = *pName;
+		if(c >= 'A' && c <= 'Z')
+			c += 'a' - 'A';
+		Hash = (Hash ^ c) * 16777619u;
+	}
+	return Hash & (COMMAND_HASH_SIZE - 1);
+}
+
 void CConsole::AddCommandSorted(CCommand *pCommand)
 {
 	if(!m_pFirstCommand || str_comp(pCommand->m_pName, m_pFirstCommand->m_pName) <= 0)
 	{
-		if(m_pFirstCommand && m_pFirstCommand->m_pNext)
-			pCommand->m_pNext = m_pFirstCommand;
-		else
-			pCommand->m_pNext = 0;
+		pCommand->m_pNext = m_pFirstCommand;
 		m_pFirstCommand = pCommand;
 	}
 	else
@@ -1191,6 +1203,58 @@ void CConsole::AddCommandSorted(CCommand *pCommand)
 			}
 		}
 	}
+
+	// the chains use the same ordering, so FindCommand still returns the first match of the list
+	CCommand **ppSlot = &m_apCommandHash[CommandHash(pCommand->m_pName)];
+	while(*ppSlot && str_comp(pCommand->m_pName, (*ppSlot)->m_pName) > 0)
+		ppSlot = &(*ppSlot)->m_pNextHash;
+	pCommand->m_pNextHash = *ppSlot;
+	*ppSlot = pCommand;
+}
+
+void CConsole::RemoveCommand(CCommand *pCommand)
+{
+	for(CCommand **ppNext = &m_pFirstCommand; *ppNext; ppNext = &(*ppNext)->m_pNext)
+	{
+		if(*ppNext == pCommand)
+		{
+			*ppNext = pCommand->m_pNext;
+			break;
+		}
+	}
+	RemoveCommandHash(pCommand);
+}
+
+void CConsole::RemoveCommandHash(CCommand *pCommand)
+{
+	for(CCommand **ppSlot = &m_apCommandHash[CommandHash(pCommand->m_pName)]; *ppSlot; ppSlot = &(*ppSlot)->m_pNextHash)
+	{
+		if(*ppSlot == pCommand)
+		{
+			*ppSlot = pCommand->m_pNextHash;
+			break;
+		}
+	}
+}
+
+void CConsole::RebuildCommandHash()
+{
+	// walk the list backwards by prepending, keeping the chains in list order
+	mem_zero(m_apCommandHash, sizeof(m_apCommandHash));
+	CCommand *pReversed = 0;
+	for(CCommand *pCommand = m_pFirstCommand; pCommand; pCommand = pCommand->m_pNext)
+	{
+		pCommand->m_pNextHash = pReversed;
+		pReversed = pCommand;
+	}
+	while(pReversed)
+	{
+		CCommand *pPrev = pReversed->m_pNextHash;
+		CCommand *&pSlot = m_apCommandHash[CommandHash(pReversed->m_pName)];
+		pReversed->m_pNextHash = pSlot;
+		pSlot = pReversed;
+		pReversed = pPrev;
+	}
 }
 
 void CConsole::Register(const char *pName, const char *pParams,
@@ -1203,6 +1267,12 @@ void CConsole::Register(const char *pName, const char *pParams,
 		pCommand = new CCommand();
 		DoAdd = true;
 	}
+	else if(str_comp(pCommand->m_pName, pName) != 0)
+	{
+		// the name only differs in case, move it so the list stays sorted
+		RemoveCommand(pCommand);
+		DoAdd = true;
+	}
 	pCommand->m_pfnCallback = pfnFunc;
 	pCommand->m_pUserData = pUser;
 
@@ -1281,6 +1351,7 @@ void CConsole::DeregisterTemp(const char *pName)
 	// add to recycle list
 	if(pRemoved)
 	{
+		RemoveCommandHash(pRemoved);
 		pRemoved->m_pNext = m_pRecycleList;
 		m_pRecycleList = pRemoved;
 	}
@@ -1306,6 +1377,7 @@ void CConsole::DeregisterTempAll()
 
 	m_TempCommands.Reset();
 	m_pRecycleList = 0;
+	RebuildCommandHash();
 }
 
 void CConsole::Con_Chain(IResult *pResult, void *pUserData)
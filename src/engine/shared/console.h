@@ -14,6 +14,7 @@ class CConsole : public IConsole
 	{
 	public:
 		CCommand *m_pNext;
+		CCommand *m_pNextHash;
 		int m_Flags;
 		bool m_Temp;
 		FCommandCallback m_pfnCallback;
@@ -33,10 +34,17 @@ class CConsole : public IConsole
 		void *m_pUserData;
 	};
 
+	enum
+	{
+		COMMAND_HASH_SIZE = 1024,
+	};
+
 	int m_FlagMask;
 	bool m_StoreCommands;
 	const char *m_apStrokeStr[2];
 	CCommand *m_pFirstCommand;
+	// case-insensitive index of m_pFirstCommand, each chain is in list order
+	CCommand *m_apCommandHash[COMMAND_HASH_SIZE];
 
 	class CExecFile
 	{
@@ -197,7 +205,11 @@ class CConsole : public IConsole
 		}
 	} m_ExecutionQueue;
 
+	static unsigned CommandHash(const char *pName);
 	void AddCommandSorted(CCommand *pCommand);
+	void RemoveCommand(CCommand *pCommand);
+	void RemoveCommandHash(CCommand *pCommand);
+	void RebuildCommandHash();
 	CCommand *FindCommand(const char *pName, int FlagMask);
 
 	bool m_Cheated;
@@ -7,11 +7,15 @@
 #include <base/log.h>
 #include <base/math.h>
 #include <base/system.h>
+#include <engine/engine.h>
 #include <engine/storage.h>
 
+#include "jobs.h"
 #include "uuid_manager.h"
 
+#include <atomic>
 #include <cstdlib>
+#include <thread>
 
 static const int DEBUG = 0;
 
@@ -87,10 +91,30 @@ struct CDatafile
 	CDatafileHeader m_Header;
 	int m_DataStartOffset;
 	char **m_ppDataPtrs;
+	bool *m_pDataBorrowed; // the data points into the mapped file or the arena
 	char *m_pData;
+	char *m_pMappedFile;
+	unsigned m_MappedSize;
+};
+
+enum
+{
+	// the decompressed datas of a mapped file share arena blocks, larger ones are allocated separately
+	ARENA_BLOCK_SIZE = 64 * 1024,
+	ARENA_MAX_DATA_SIZE = ARENA_BLOCK_SIZE / 4,
 };
 
 bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	return OpenImpl(pStorage, pFilename, StorageType, false);
+}
+
+bool CDataFileReader::OpenMapped(class IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	return OpenImpl(pStorage, pFilename, StorageType, true);
+}
+
+bool CDataFileReader::OpenImpl(class IStorage *pStorage, const char *pFilename, int StorageType, bool Mapped)
 {
 	log_trace("datafile", "loading. filename='%s'", pFilename);
 
@@ -101,9 +125,23 @@ bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int
 		return false;
 	}
 
+	char *pMappedFile = nullptr;
+	unsigned MappedSize = 0;
+#if !defined(CONF_ARCH_ENDIAN_BIG)
+	// the big endian hosts have to swap the tables, keep reading the file for them
+	if(Mapped)
+		pMappedFile = static_cast<char *>(io_map(File, &MappedSize));
+#endif
+
 	// take the CRC of the file and store it
 	unsigned Crc = 0;
 	SHA256_DIGEST Sha256;
+	if(pMappedFile)
+	{
+		Crc = crc32(Crc, (const Bytef *)pMappedFile, MappedSize);
+		Sha256 = sha256(pMappedFile, MappedSize);
+	}
+	else
 	{
 		enum
 		{
@@ -129,9 +167,15 @@ bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int
 
 	// TODO: change this header
 	CDatafileHeader Header;
-	if(sizeof(Header) != io_read(File, &Header, sizeof(Header)))
+	if(pMappedFile && MappedSize >= sizeof(Header))
+	{
+		mem_copy(&Header, pMappedFile, sizeof(Header));
+	}
+	else if(pMappedFile || sizeof(Header) != io_read(File, &Header, sizeof(Header)))
 	{
 		dbg_msg("datafile", "couldn't load header");
+		io_unmap(pMappedFile, MappedSize);
+		io_close(File);
 		return false;
 	}
 	if(Header.m_aID[0] != 'A' || Header.m_aID[1] != 'T' || Header.m_aID[2] != 'A' || Header.m_aID[3] != 'D')
@@ -139,6 +183,8 @@ bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int
 		if(Header.m_aID[0] != 'D' || Header.m_aID[1] != 'A' || Header.m_aID[2] != 'T' || Header.m_aID[3] != 'A')
 		{
 			dbg_msg("datafile", "wrong signature. %x %x %x %x", Header.m_aID[0], Header.m_aID[1], Header.m_aID[2], Header.m_aID[3]);
+			io_unmap(pMappedFile, MappedSize);
+			io_close(File);
 			return false;
 		}
 	}
@@ -149,6 +195,8 @@ bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int
 	if(Header.m_Version != 3 && Header.m_Version != 4)
 	{
 		dbg_msg("datafile", "wrong version. version=%x", Header.m_Version);
+		io_unmap(pMappedFile, MappedSize);
+		io_close(File);
 		return false;
 	}
 
@@ -160,26 +208,32 @@ bool CDataFileReader::Open(class IStorage *pStorage, const char *pFilename, int
 		Size += Header.m_NumRawData * sizeof(int); // v4 has uncompressed data sizes as well
 	Size += Header.m_ItemSize;
 
-	unsigned AllocSize = Size;
+	unsigned AllocSize = pMappedFile ? 0 : Size; // the mapped tables are used in place
 	AllocSize += sizeof(CDatafile); // add space for info structure
 	AllocSize += Header.m_NumRawData * sizeof(void *); // add space for data pointers
+	AllocSize += Header.m_NumRawData * sizeof(bool); // add space for the borrowed flags
 
 	CDatafile *pTmpDataFile = (CDatafile *)malloc(AllocSize);
 	pTmpDataFile->m_Header = Header;
 	pTmpDataFile->m_DataStartOffset = sizeof(CDatafileHeader) + Size;
 	pTmpDataFile->m_ppDataPtrs = (char **)(pTmpDataFile + 1);
-	pTmpDataFile->m_pData = (char *)(pTmpDataFile + 1) + Header.m_NumRawData * sizeof(char *);
+	pTmpDataFile->m_pDataBorrowed = (bool *)(pTmpDataFile->m_ppDataPtrs + Header.m_NumRawData);
+	pTmpDataFile->m_pData = pMappedFile ? pMappedFile + sizeof(CDatafileHeader) : (char *)(pTmpDataFile->m_pDataBorrowed + Header.m_NumRawData);
 	pTmpDataFile->m_File = File;
 	pTmpDataFile->m_Sha256 = Sha256;
 	pTmpDataFile->m_Crc = Crc;
+	pTmpDataFile->m_pMappedFile = pMappedFile;
+	pTmpDataFile->m_MappedSize = MappedSize;
 
 	// clear the data pointers
 	mem_zero(pTmpDataFile->m_ppDataPtrs, Header.m_NumRawData * sizeof(void *));
+	mem_zero(pTmpDataFile->m_pDataBorrowed, Header.m_NumRawData * sizeof(bool));
 
 	// read types, offsets, sizes and item data
-	unsigned ReadSize = io_read(File, pTmpDataFile->m_pData, Size);
-	if(ReadSize != Size)
+	unsigned ReadSize = pMappedFile ? minimum(Size, MappedSize - (unsigned)sizeof(CDatafileHeader)) : io_read(File, pTmpDataFile->m_pData, Size);
+	if(ReadSize != Size || (pMappedFile && (unsigned)pTmpDataFile->m_DataStartOffset + Header.m_DataSize > MappedSize))
 	{
+		io_unmap(pMappedFile, MappedSize);
 		io_close(pTmpDataFile->m_File);
 		free(pTmpDataFile);
 		dbg_msg("datafile", "couldn't load the whole thing, wanted=%d got=%d", Size, ReadSize);
@@ -224,14 +278,46 @@ bool CDataFileReader::Close()
 
 	// free the data that is loaded
 	for(int i = 0; i < m_pDataFile->m_Header.m_NumRawData; i++)
-		free(m_pDataFile->m_ppDataPtrs[i]);
+	{
+		if(!m_pDataFile->m_pDataBorrowed[i])
+			free(m_pDataFile->m_ppDataPtrs[i]);
+	}
+	for(char *pBlock : m_vpArenaBlocks)
+		free(pBlock);
+	m_vpArenaBlocks.clear();
+	m_ArenaBlockUsed = 0;
 
+	io_unmap(m_pDataFile->m_pMappedFile, m_pDataFile->m_MappedSize);
 	io_close(m_pDataFile->m_File);
 	free(m_pDataFile);
 	m_pDataFile = nullptr;
 	return true;
 }
 
+const void *CDataFileReader::MappedFile(unsigned *pSize) const
+{
+	if(!m_pDataFile || !m_pDataFile->m_pMappedFile)
+	{
+		*pSize = 0;
+		return nullptr;
+	}
+	*pSize = m_pDataFile->m_MappedSize;
+	return m_pDataFile->m_pMappedFile;
+}
+
+char *CDataFileReader::ArenaAlloc(unsigned Size)
+{
+	Size = (Size + 7) & ~7u;
+	if(m_vpArenaBlocks.empty() || m_ArenaBlockUsed + Size > ARENA_BLOCK_SIZE)
+	{
+		m_vpArenaBlocks.push_back(static_cast<char *>(malloc(ARENA_BLOCK_SIZE)));
+		m_ArenaBlockUsed = 0;
+	}
+	char *pData = m_vpArenaBlocks.back() + m_ArenaBlockUsed;
+	m_ArenaBlockUsed += Size;
+	return pData;
+}
+
 IOHANDLE CDataFileReader::File() const
 {
 	if(!m_pDataFile)
@@ -285,6 +371,38 @@ void *CDataFileReader::GetDataImpl(int Index, int Swap)
 	if(Index < 0 || Index >= m_pDataFile->m_Header.m_NumRawData)
 		return nullptr;
 
+	// serve the mapped file directly, only the compressed datas need a buffer
+	if(!m_pDataFile->m_ppDataPtrs[Index] && m_pDataFile->m_pMappedFile)
+	{
+		int DataSize = GetFileDataSize(Index);
+		char *pFileData = m_pDataFile->m_pMappedFile + m_pDataFile->m_DataStartOffset + m_pDataFile->m_Info.m_pDataOffsets[Index];
+		if(DataSize < 0 || pFileData < m_pDataFile->m_pMappedFile || pFileData + DataSize > m_pDataFile->m_pMappedFile + m_pDataFile->m_MappedSize)
+			return nullptr;
+
+		if(m_pDataFile->m_Header.m_Version == 4)
+		{
+			unsigned long UncompressedSize = m_pDataFile->m_Info.m_pDataSizes[Index];
+			log_trace("datafile", "decompressing mapped data index=%d size=%d uncompressed=%lu", Index, DataSize, UncompressedSize);
+
+			const bool InArena = UncompressedSize <= ARENA_MAX_DATA_SIZE;
+			m_pDataFile->m_ppDataPtrs[Index] = InArena ? ArenaAlloc(UncompressedSize) : (char *)malloc(UncompressedSize);
+			m_pDataFile->m_pDataBorrowed[Index] = InArena;
+
+			unsigned long s = UncompressedSize;
+			if(uncompress((Bytef *)m_pDataFile->m_ppDataPtrs[Index], &s, (Bytef *)pFileData, DataSize) != Z_OK || s != UncompressedSize)
+			{
+				log_error("datafile", "failed to decompress data index=%d size=%d uncompressed=%lu", Index, DataSize, UncompressedSize);
+				UnloadData(Index);
+				return nullptr;
+			}
+		}
+		else
+		{
+			m_pDataFile->m_ppDataPtrs[Index] = pFileData;
+			m_pDataFile->m_pDataBorrowed[Index] = true;
+		}
+	}
+
 	// load it if needed
 	if(!m_pDataFile->m_ppDataPtrs[Index])
 	{
@@ -351,9 +469,11 @@ void CDataFileReader::UnloadData(int Index)
 	if(Index < 0 || Index >= m_pDataFile->m_Header.m_NumRawData)
 		return;
 
-	//
-	free(m_pDataFile->m_ppDataPtrs[Index]);
+	// the borrowed memory is released on Close()
+	if(!m_pDataFile->m_pDataBorrowed[Index])
+		free(m_pDataFile->m_ppDataPtrs[Index]);
 	m_pDataFile->m_ppDataPtrs[Index] = nullptr;
+	m_pDataFile->m_pDataBorrowed[Index] = false;
 }
 
 int CDataFileReader::GetItemSize(int Index) const
@@ -518,6 +638,7 @@ int CDataFileReader::MapSize() const
 CDataFileWriter::CDataFileWriter()
 {
 	m_File = 0;
+	m_pCompressionEngine = nullptr;
 	m_pItemTypes = static_cast<CItemTypeInfo *>(calloc(MAX_ITEM_TYPES, sizeof(CItemTypeInfo)));
 	m_pItems = static_cast<CItemInfo *>(calloc(MAX_ITEMS, sizeof(CItemInfo)));
 	m_pDatas = static_cast<CDataInfo *>(calloc(MAX_DATAS, sizeof(CDataInfo)));
@@ -530,7 +651,10 @@ CDataFileWriter::~CDataFileWriter()
 	for(int i = 0; i < m_NumItems; i++)
 		free(m_pItems[i].m_pData);
 	for(int i = 0; i < m_NumDatas; ++i)
+	{
+		free(m_pDatas[i].m_pUncompressedData);
 		free(m_pDatas[i].m_pCompressedData);
+	}
 	free(m_pItems);
 	m_pItems = nullptr;
 	free(m_pDatas);
@@ -631,26 +755,106 @@ int CDataFileWriter::AddItem(int Type, int ID, int Size, void *pData)
 	return m_NumItems - 1;
 }
 
-int CDataFileWriter::AddData(int Size, void *pData, int CompressionLevel)
+void CDataFileWriter::CompressData(CDataInfo *pInfo)
 {
-	dbg_assert(m_NumDatas < 1024, "too much data");
-
-	CDataInfo *pInfo = &m_pDatas[m_NumDatas];
-	unsigned long s = compressBound(Size);
-	void *pCompData = malloc(s); // temporary buffer that we use during compression
+	const void *pData = pInfo->m_pUncompressedData;
+	unsigned long s = compressBound(pInfo->m_UncompressedSize);
+	void *pCompData = malloc(s);
 
-	int Result = compress2((Bytef *)pCompData, &s, (Bytef *)pData, Size, CompressionLevel);
+	int Result = compress2((Bytef *)pCompData, &s, (const Bytef *)pData, pInfo->m_UncompressedSize, pInfo->m_CompressionLevel);
 	if(Result != Z_OK)
 	{
 		dbg_msg("datafile", "compression error %d", Result);
 		dbg_assert(0, "zlib error");
 	}
 
-	pInfo->m_UncompressedSize = Size;
+	// shrink the buffer in place instead of copying the data
 	pInfo->m_CompressedSize = (int)s;
-	pInfo->m_pCompressedData = malloc(pInfo->m_CompressedSize);
-	mem_copy(pInfo->m_pCompressedData, pCompData, pInfo->m_CompressedSize);
-	free(pCompData);
+	pInfo->m_pCompressedData = realloc(pCompData, maximum<unsigned long>(s, 1));
+}
+
+// Hands out the deferred datas to the workers, including the thread in Finish() which
+// also compresses and so never waits for a job that has not been started by the pool
+class CDataFileWriter::CCompressionQueue
+{
+public:
+	CDataInfo *m_pDatas;
+	int m_NumDatas;
+	std::atomic<int> m_NextData;
+	std::atomic<int> m_NumCompressed;
+
+	CCompressionQueue(CDataInfo *pDatas, int NumDatas) :
+		m_pDatas(pDatas), m_NumDatas(NumDatas), m_NextData(0), m_NumCompressed(0)
+	{
+	}
+
+	void Work()
+	{
+		while(true)
+		{
+			const int Index = m_NextData.fetch_add(1);
+			if(Index >= m_NumDatas)
+				return;
+			CompressData(&m_pDatas[Index]);
+			m_NumCompressed.fetch_add(1);
+		}
+	}
+};
+
+class CDataFileWriter::CCompressionJob : public IJob
+{
+	std::shared_ptr<CCompressionQueue> m_pQueue;
+
+	void Run() override
+	{
+		m_pQueue->Work();
+	}
+
+public:
+	CCompressionJob(std::shared_ptr<CCompressionQueue> pQueue) :
+		m_pQueue(std::move(pQueue))
+	{
+	}
+};
+
+void CDataFileWriter::CompressDeferredData()
+{
+	auto pQueue = std::make_shared<CCompressionQueue>(m_pDatas, m_NumDatas);
+	const int NumJobs = minimum(m_NumDatas - 1, (int)std::thread::hardware_concurrency());
+	for(int i = 0; i < NumJobs; i++)
+		m_pCompressionEngine->AddJob(std::make_shared<CCompressionJob>(pQueue));
+
+	pQueue->Work();
+	while(pQueue->m_NumCompressed.load() < m_NumDatas)
+		thread_yield();
+
+	for(int i = 0; i < m_NumDatas; i++)
+	{
+		free(m_pDatas[i].m_pUncompressedData);
+		m_pDatas[i].m_pUncompressedData = nullptr;
+	}
+}
+
+int CDataFileWriter::AddData(int Size, void *pData, int CompressionLevel)
+{
+	dbg_assert(m_NumDatas < 1024, "too much data");
+
+	CDataInfo *pInfo = &m_pDatas[m_NumDatas];
+	pInfo->m_UncompressedSize = Size;
+	pInfo->m_CompressionLevel = CompressionLevel;
+	pInfo->m_pCompressedData = nullptr;
+	if(m_pCompressionEngine)
+	{
+		// the caller may reuse its buffer before Finish()
+		pInfo->m_pUncompressedData = malloc(maximum(Size, 1));
+		mem_copy(pInfo->m_pUncompressedData, pData, Size);
+	}
+	else
+	{
+		pInfo->m_pUncompressedData = pData;
+		CompressData(pInfo);
+		pInfo->m_pUncompressedData = nullptr;
+	}
 
 	m_NumDatas++;
 	return m_NumDatas - 1;
@@ -677,6 +881,9 @@ int CDataFileWriter::Finish()
 	if(!m_File)
 		return 1;
 
+	if(m_pCompressionEngine)
+		CompressDeferredData();
+
 	// we should now write this file!
 	if(DEBUG)
 		dbg_msg("datafile", "writing");
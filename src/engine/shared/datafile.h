@@ -10,6 +10,10 @@
 
 #include <zlib.h>
 
+#include <vector>
+
+class IEngine;
+
 enum
 {
 	ITEMTYPE_EX = 0xffff,
@@ -19,8 +23,13 @@ enum
 class CDataFileReader
 {
 	struct CDatafile *m_pDataFile;
+	std::vector<char *> m_vpArenaBlocks;
+	unsigned m_ArenaBlockUsed = 0;
+
+	bool OpenImpl(class IStorage *pStorage, const char *pFilename, int StorageType, bool Mapped);
 	void *GetDataImpl(int Index, int Swap);
 	int GetFileDataSize(int Index) const;
+	char *ArenaAlloc(unsigned Size);
 
 	int GetExternalItemType(int InternalType);
 	int GetInternalItemType(int ExternalType);
@@ -31,7 +40,12 @@ public:
 	~CDataFileReader() { Close(); }
 
 	bool Open(class IStorage *pStorage, const char *pFilename, int StorageType);
+	// Serves the tables and the uncompressed datas straight from the memory mapped file,
+	// falls back to Open() where the file can't be mapped
+	bool OpenMapped(class IStorage *pStorage, const char *pFilename, int StorageType);
 	bool Close();
+	// The whole file if it is memory mapped, valid until Close()
+	const void *MappedFile(unsigned *pSize) const;
 	bool IsOpen() const { return m_pDataFile != nullptr; }
 	IOHANDLE File() const;
 
@@ -60,9 +74,14 @@ class CDataFileWriter
 	{
 		int m_UncompressedSize;
 		int m_CompressedSize;
+		void *m_pUncompressedData; // copy of the data until Finish() when the compression is deferred
 		void *m_pCompressedData;
+		int m_CompressionLevel;
 	};
 
+	class CCompressionQueue;
+	class CCompressionJob;
+
 	struct CItemInfo
 	{
 		int m_Type;
@@ -97,9 +116,12 @@ class CDataFileWriter
 	CItemInfo *m_pItems;
 	CDataInfo *m_pDatas;
 	int m_aExtendedItemTypes[MAX_EXTENDED_ITEM_TYPES];
+	IEngine *m_pCompressionEngine;
 
 	int GetTypeFromIndex(int Index) const;
 	int GetExtendedItemTypeIndex(int Type);
+	static void CompressData(CDataInfo *pInfo);
+	void CompressDeferredData();
 
 public:
 	CDataFileWriter();
@@ -107,6 +129,9 @@ public:
 	void Init();
 	bool OpenFile(class IStorage *pStorage, const char *pFilename, int StorageType = IStorage::TYPE_SAVE);
 	bool Open(class IStorage *pStorage, const char *pFilename, int StorageType = IStorage::TYPE_SAVE);
+	// AddData() only copies the data and Finish() compresses them in parallel on the job pool of the engine.
+	// The output is the same as with the serial compression.
+	void SetParallelCompression(IEngine *pEngine) { m_pCompressionEngine = pEngine; }
 	int AddData(int Size, void *pData, int CompressionLevel = Z_DEFAULT_COMPRESSION);
 	int AddDataSwapped(int Size, void *pData);
 	int AddItem(int Type, int ID, int Size, void *pData);
@@ -35,13 +35,22 @@ static const ColorRGBA gs_DemoPrintColor{0.75f, 0.7f, 0.7f, 1.0f};
 
 CDemoRecorder::CDemoRecorder(class CSnapshotDelta *pSnapshotDelta, bool NoMapData)
 {
+	m_pConsole = 0;
+	m_pStorage = 0;
 	m_File = 0;
 	m_aCurrentFilename[0] = '\0';
 	m_pfnFilter = 0;
 	m_pUser = 0;
 	m_LastTickMarker = -1;
+	m_LastKeyFrame = -1;
+	m_FirstTick = -1;
+	m_NumTimelineMarkers = 0;
 	m_pSnapshotDelta = pSnapshotDelta;
 	m_NoMapData = NoMapData;
+	m_pWriter = 0;
+	m_pBackend = 0;
+	m_StopMode = EStopMode::KEEP_FILE;
+	m_aTargetFilename[0] = '\0';
 }
 
 // Record
@@ -65,7 +74,7 @@ int CDemoRecorder::Start(class IStorage *pStorage, class IConsole *pConsole, con
 		return -1;
 	}
 
-	if(m_File)
+	if(IsRecording())
 	{
 		io_close(DemoFile);
 		return -1;
@@ -185,9 +194,22 @@ int CDemoRecorder::Start(class IStorage *pStorage, class IConsole *pConsole, con
 		str_format(aBuf, sizeof(aBuf), "Recording to '%s'", pFilename);
 		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", aBuf, gs_DemoPrintColor);
 	}
-	m_File = DemoFile;
+	m_pStorage = pStorage;
 	str_copy(m_aCurrentFilename, pFilename);
 
+	if(m_pWriter)
+	{
+		// the chunks are compressed and written by the writer thread, which
+		// also owns the backend until it has processed the stop
+		m_pBackend = new CDemoRecorder(m_pSnapshotDelta, m_NoMapData);
+		m_pBackend->m_pStorage = pStorage;
+		m_pBackend->m_pWriter = m_pWriter;
+		m_pBackend->m_File = DemoFile;
+		str_copy(m_pBackend->m_aCurrentFilename, pFilename);
+	}
+	else
+		m_File = DemoFile;
+
 	return 0;
 }
 
@@ -298,6 +320,16 @@ void CDemoRecorder::Write(int Type, const void *pData, int Size)
 
 void CDemoRecorder::RecordSnapshot(int Tick, const void *pData, int Size)
 {
+	if(m_pBackend)
+	{
+		// keep track of the ticks for Length() and AddDemoMarker()
+		if(m_FirstTick < 0)
+			m_FirstTick = Tick;
+		m_LastTickMarker = Tick;
+		m_pBackend->m_pWriter->Push(m_pBackend, CDemoRecordWriter::ENTRY_SNAPSHOT, Tick, pData, Size, false);
+		return;
+	}
+
 	if(m_LastKeyFrame == -1 || (Tick - m_LastKeyFrame) > SERVER_TICK_SPEED * 5)
 	{
 		// write full tickmarker
@@ -337,11 +369,31 @@ void CDemoRecorder::RecordMessage(const void *pData, int Size)
 			return;
 		}
 	}
+	if(m_pBackend)
+	{
+		m_pBackend->m_pWriter->Push(m_pBackend, CDemoRecordWriter::ENTRY_MESSAGE, -1, pData, Size, false);
+		return;
+	}
 	Write(CHUNKTYPE_MESSAGE, pData, Size);
 }
 
-int CDemoRecorder::Stop()
+int CDemoRecorder::Stop(IDemoRecorder::EStopMode Mode, const char *pTargetFilename)
 {
+	if(m_pBackend)
+	{
+		// the markers are only read by the writer thread once it reaches the stop
+		mem_copy(m_pBackend->m_aTimelineMarkers, m_aTimelineMarkers, sizeof(m_aTimelineMarkers[0]) * m_NumTimelineMarkers);
+		m_pBackend->m_NumTimelineMarkers = m_NumTimelineMarkers;
+		m_pBackend->m_StopMode = Mode;
+		str_copy(m_pBackend->m_aTargetFilename, pTargetFilename);
+		m_pBackend->m_pWriter->Push(m_pBackend, CDemoRecordWriter::ENTRY_STOP, -1, nullptr, 0, true);
+		m_pBackend = nullptr;
+
+		if(m_pConsole)
+			m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", "Stopped recording", gs_DemoPrintColor);
+		return 0;
+	}
+
 	if(!m_File)
 		return -1;
 
@@ -365,6 +417,12 @@ int CDemoRecorder::Stop()
 
 	io_close(m_File);
 	m_File = 0;
+
+	if(Mode == IDemoRecorder::EStopMode::REMOVE_FILE)
+		m_pStorage->RemoveFile(m_aCurrentFilename, IStorage::TYPE_SAVE);
+	else if(pTargetFilename[0] != '\0')
+		m_pStorage->RenameFile(m_aCurrentFilename, pTargetFilename, IStorage::TYPE_SAVE);
+
 	if(m_pConsole)
 		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", "Stopped recording", gs_DemoPrintColor);
 
@@ -398,6 +456,144 @@ void CDemoRecorder::AddDemoMarker(int Tick)
 		m_pConsole->Print(IConsole::OUTPUT_LEVEL_STANDARD, "demo_recorder", "Added timeline marker", gs_DemoPrintColor);
 }
 
+CDemoRecordWriter::CDemoRecordWriter(int QueueSize) :
+	m_WritePos(0), m_ReadPos(0), m_ProducerWaiting(false),
+	m_QueuedChunks(0), m_QueuedBytes(0), m_WrittenChunks(0), m_DroppedChunks(0), m_BlockedPushes(0), m_BlockedTime(0), m_QueuePeak(0)
+{
+	static_assert(sizeof(CEntry) % 8 == 0, "the queue entries must keep the data aligned");
+
+	// the biggest snapshot must always fit, even behind the padding at the end of the queue
+	m_QueueSize = maximum(QueueSize, 2 * (int)(sizeof(CEntry) + CSnapshot::MAX_SIZE)) & ~7;
+	m_pQueue = (unsigned char *)malloc(m_QueueSize);
+	m_Policy = POLICY_BLOCK;
+	m_pThread = thread_init(ThreadMain, this, "demo writer");
+}
+
+CDemoRecordWriter::~CDemoRecordWriter()
+{
+	// everything queued before is still written
+	Push(nullptr, ENTRY_QUIT, -1, nullptr, 0, true);
+	thread_wait(m_pThread);
+	free(m_pQueue);
+}
+
+bool CDemoRecordWriter::Push(CDemoRecorder *pRecorder, int Type, int Tick, const void *pData, int Size, bool Block)
+{
+	const int EntrySize = sizeof(CEntry) + ((Size + 7) & ~7);
+	uint64_t WritePos = m_WritePos.load(std::memory_order_relaxed);
+	int Offset = WritePos % m_QueueSize;
+
+	// entries are never split, skip the rest of the queue if this one doesn't fit there
+	const int Padding = m_QueueSize - Offset < EntrySize ? m_QueueSize - Offset : 0;
+	const uint64_t End = WritePos + Padding + EntrySize;
+
+	if(End - m_ReadPos.load() > (uint64_t)m_QueueSize)
+	{
+		if(!Block && m_Policy == POLICY_DROP)
+		{
+			m_DroppedChunks++;
+			return false;
+		}
+
+		const int64_t BlockStart = time_get_impl();
+		m_BlockedPushes++;
+		while(true)
+		{
+			m_ProducerWaiting.store(true);
+			if(End - m_ReadPos.load() <= (uint64_t)m_QueueSize)
+				break;
+			m_SpaceAvailable.Wait();
+		}
+		m_ProducerWaiting.store(false);
+		m_BlockedTime += time_get_impl() - BlockStart;
+	}
+
+	if(Padding >= (int)sizeof(CEntry))
+		((CEntry *)(m_pQueue + Offset))->m_Type = ENTRY_PADDING;
+	WritePos += Padding;
+	Offset = WritePos % m_QueueSize;
+
+	CEntry *pEntry = (CEntry *)(m_pQueue + Offset);
+	pEntry->m_pRecorder = pRecorder;
+	pEntry->m_Type = Type;
+	pEntry->m_Tick = Tick;
+	pEntry->m_Size = Size;
+	if(Size)
+		mem_copy(pEntry + 1, pData, Size);
+
+	m_WritePos.store(End, std::memory_order_release);
+	m_DataAvailable.Signal();
+
+	m_QueuedChunks++;
+	m_QueuedBytes += Size;
+	const int Usage = End - m_ReadPos.load(std::memory_order_relaxed);
+	if(Usage > m_QueuePeak.load(std::memory_order_relaxed))
+		m_QueuePeak.store(Usage, std::memory_order_relaxed);
+	return true;
+}
+
+void CDemoRecordWriter::ThreadMain(void *pUser)
+{
+	static_cast<CDemoRecordWriter *>(pUser)->Run();
+}
+
+void CDemoRecordWriter::Run()
+{
+	while(true)
+	{
+		// signaled once per entry, the padding is skipped along with the next one
+		m_DataAvailable.Wait();
+
+		uint64_t ReadPos = m_ReadPos.load(std::memory_order_relaxed);
+		dbg_assert(ReadPos < m_WritePos.load(std::memory_order_acquire), "demo writer queue underflow");
+		int Offset = ReadPos % m_QueueSize;
+		if(m_QueueSize - Offset < (int)sizeof(CEntry) || ((CEntry *)(m_pQueue + Offset))->m_Type == ENTRY_PADDING)
+		{
+			ReadPos += m_QueueSize - Offset;
+			Offset = 0;
+		}
+
+		const CEntry *pEntry = (CEntry *)(m_pQueue + Offset);
+		CDemoRecorder *pRecorder = pEntry->m_pRecorder;
+		const int Type = pEntry->m_Type;
+		switch(Type)
+		{
+		case ENTRY_SNAPSHOT:
+			pRecorder->RecordSnapshot(pEntry->m_Tick, pEntry + 1, pEntry->m_Size);
+			m_WrittenChunks++;
+			break;
+		case ENTRY_MESSAGE:
+			pRecorder->RecordMessage(pEntry + 1, pEntry->m_Size);
+			m_WrittenChunks++;
+			break;
+		case ENTRY_STOP:
+			pRecorder->Stop(pRecorder->m_StopMode, pRecorder->m_aTargetFilename);
+			delete pRecorder;
+			break;
+		}
+
+		m_ReadPos.store(ReadPos + sizeof(CEntry) + ((pEntry->m_Size + 7) & ~7));
+		if(m_ProducerWaiting.exchange(false))
+			m_SpaceAvailable.Signal();
+
+		if(Type == ENTRY_QUIT)
+			break;
+	}
+}
+
+void CDemoRecordWriter::GetStats(CStats *pStats) const
+{
+	pStats->m_QueuedChunks = m_QueuedChunks;
+	pStats->m_QueuedBytes = m_QueuedBytes;
+	pStats->m_WrittenChunks = m_WrittenChunks;
+	pStats->m_DroppedChunks = m_DroppedChunks;
+	pStats->m_BlockedPushes = m_BlockedPushes;
+	pStats->m_BlockedTime = m_BlockedTime;
+	pStats->m_QueueSize = m_QueueSize;
+	pStats->m_QueueUsage = m_WritePos.load() - m_ReadPos.load();
+	pStats->m_QueuePeak = m_QueuePeak;
+}
+
 CDemoPlayer::CDemoPlayer(class CSnapshotDelta *pSnapshotDelta, TUpdateIntraTimesFunc &&UpdateIntraTimesFunc)
 {
 	Construct(pSnapshotDelta);
@@ -1212,7 +1408,7 @@ void CDemoEditor::Slice(const char *pDemo, const char *pDst, int StartTick, int
 	}
 
 	m_pDemoPlayer->Stop();
-	m_pDemoRecorder->Stop();
+	m_pDemoRecorder->Stop(IDemoRecorder::EStopMode::KEEP_FILE);
 } // NOLINT(clang-analyzer-unix.Malloc)
 
 void CDemoEditor::OnDemoPlayerSnapshot(void *pData, int Size)
@@ -4,9 +4,11 @@
 #define ENGINE_SHARED_DEMO_H
 
 #include <base/hash.h>
+#include <base/tl/threading.h>
 
 #include <engine/demo.h>
 #include <engine/shared/protocol.h>
+#include <atomic>
 #include <functional>
 
 #include "snapshot.h"
@@ -15,7 +17,10 @@ typedef std::function<void()> TUpdateIntraTimesFunc;
 
 class CDemoRecorder : public IDemoRecorder
 {
+	friend class CDemoRecordWriter;
+
 	class IConsole *m_pConsole;
+	class IStorage *m_pStorage;
 	IOHANDLE m_File;
 	char m_aCurrentFilename[256];
 	int m_LastTickMarker;
@@ -31,6 +36,13 @@ class CDemoRecorder : public IDemoRecorder
 	DEMOFUNC_FILTER m_pfnFilter;
 	void *m_pUser;
 
+	// with a writer, the file is handed to a backend recorder that is only
+	// touched by the writer thread until it is stopped
+	class CDemoRecordWriter *m_pWriter;
+	CDemoRecorder *m_pBackend;
+	EStopMode m_StopMode;
+	char m_aTargetFilename[IO_MAX_PATH_LENGTH];
+
 	void WriteTickMarker(int Tick, int Keyframe);
 	void Write(int Type, const void *pData, int Size);
 
@@ -38,8 +50,11 @@ public:
 	CDemoRecorder(class CSnapshotDelta *pSnapshotDelta, bool NoMapData = false);
 	CDemoRecorder() {}
 
+	// takes effect with the next Start()
+	void SetWriter(class CDemoRecordWriter *pWriter) { m_pWriter = pWriter; }
+
 	int Start(class IStorage *pStorage, class IConsole *pConsole, const char *pFilename, const char *pNetversion, const char *pMap, SHA256_DIGEST *pSha256, unsigned MapCrc, const char *pType, unsigned MapSize, unsigned char *pMapData, IOHANDLE MapFile = nullptr, DEMOFUNC_FILTER pfnFilter = nullptr, void *pUser = nullptr);
-	int Stop() override;
+	int Stop(IDemoRecorder::EStopMode Mode, const char *pTargetFilename = "") override;
 
 	void AddDemoMarker();
 	void AddDemoMarker(int Tick);
@@ -47,13 +62,89 @@ public:
 	void RecordSnapshot(int Tick, const void *pData, int Size);
 	void RecordMessage(const void *pData, int Size);
 
-	bool IsRecording() const override { return m_File != nullptr; }
+	bool IsRecording() const override { return m_File != nullptr || m_pBackend != nullptr; }
 	char *GetCurrentFilename() override { return m_aCurrentFilename; }
 	void ClearCurrentFilename() { m_aCurrentFilename[0] = '\0'; }
 
 	int Length() const override { return (m_LastTickMarker - m_FirstTick) / SERVER_TICK_SPEED; }
 };
 
+// Compresses and writes the demo chunks of asynchronous recorders on its own thread.
+// The recorders push the raw snapshots and messages into a bounded single producer,
+// single consumer ring buffer, so all of them must be used from the same thread.
+class CDemoRecordWriter
+{
+public:
+	enum
+	{
+		POLICY_BLOCK = 0, // wait for the writer thread when the queue is full
+		POLICY_DROP, // drop the snapshots and messages that don't fit
+	};
+
+	struct CStats
+	{
+		uint64_t m_QueuedChunks;
+		uint64_t m_QueuedBytes;
+		uint64_t m_WrittenChunks;
+		uint64_t m_DroppedChunks;
+		uint64_t m_BlockedPushes;
+		int64_t m_BlockedTime;
+		int m_QueueSize;
+		int m_QueueUsage;
+		int m_QueuePeak;
+	};
+
+	CDemoRecordWriter(int QueueSize);
+	~CDemoRecordWriter();
+
+	void SetPolicy(int Policy) { m_Policy = Policy; }
+	void GetStats(CStats *pStats) const;
+
+private:
+	friend class CDemoRecorder;
+
+	enum
+	{
+		ENTRY_PADDING = 0,
+		ENTRY_SNAPSHOT,
+		ENTRY_MESSAGE,
+		ENTRY_STOP,
+		ENTRY_QUIT,
+	};
+
+	struct CEntry
+	{
+		CDemoRecorder *m_pRecorder;
+		int m_Type;
+		int m_Tick;
+		int m_Size;
+	};
+
+	unsigned char *m_pQueue;
+	int m_QueueSize;
+	int m_Policy;
+	void *m_pThread;
+
+	// positions only grow, the offset into the queue is the position modulo the size
+	std::atomic<uint64_t> m_WritePos;
+	std::atomic<uint64_t> m_ReadPos;
+	std::atomic<bool> m_ProducerWaiting;
+	CSemaphore m_DataAvailable;
+	CSemaphore m_SpaceAvailable;
+
+	std::atomic<uint64_t> m_QueuedChunks;
+	std::atomic<uint64_t> m_QueuedBytes;
+	std::atomic<uint64_t> m_WrittenChunks;
+	std::atomic<uint64_t> m_DroppedChunks;
+	std::atomic<uint64_t> m_BlockedPushes;
+	std::atomic<int64_t> m_BlockedTime;
+	std::atomic<int> m_QueuePeak;
+
+	bool Push(CDemoRecorder *pRecorder, int Type, int Tick, const void *pData, int Size, bool Block);
+	static void ThreadMain(void *pUser);
+	void Run();
+};
+
 class CDemoPlayer : public IDemoPlayer
 {
 public:
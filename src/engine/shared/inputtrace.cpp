@@ -0,0 +1,353 @@
+#include "inputtrace.h"
+
+#include "compression.h"
+
+#include <engine/storage.h>
+
+const unsigned char CInputTrace::ms_aMagic[8] = {'I', 'N', 'P', 'T', 'R', 'A', 'C', 'E'};
+
+static const int BUFFER_FLUSH_SIZE = 64 * 1024;
+
+CInputTraceWriter::CInputTraceWriter()
+{
+	m_File = nullptr;
+	m_PendingTicks = 0;
+	m_Size = 0;
+}
+
+CInputTraceWriter::~CInputTraceWriter()
+{
+	Stop();
+}
+
+void CInputTraceWriter::AddInt(int Value)
+{
+	unsigned char aBuf[CVariableInt::MAX_BYTES_PACKED];
+	const unsigned char *pEnd = CVariableInt::Pack(aBuf, Value, sizeof(aBuf));
+	m_vBuffer.insert(m_vBuffer.end(), (const unsigned char *)aBuf, pEnd);
+}
+
+void CInputTraceWriter::AddRaw(const void *pData, int Size)
+{
+	const unsigned char *pBytes = static_cast<const unsigned char *>(pData);
+	m_vBuffer.insert(m_vBuffer.end(), pBytes, pBytes + Size);
+}
+
+void CInputTraceWriter::FlushTicks()
+{
+	if(!m_PendingTicks)
+		return;
+	AddInt(RECORD_TICKS);
+	AddInt(m_PendingTicks);
+	m_PendingTicks = 0;
+}
+
+void CInputTraceWriter::Flush()
+{
+	if(m_vBuffer.empty())
+		return;
+	io_write(m_File, m_vBuffer.data(), m_vBuffer.size());
+	m_Size += m_vBuffer.size();
+	m_vBuffer.clear();
+}
+
+bool CInputTraceWriter::Start(IStorage *pStorage, const char *pFilename, const char *pMapName, unsigned MapCrc, unsigned Seed)
+{
+	Stop();
+
+	m_File = pStorage->OpenFile(pFilename, IOFLAG_WRITE, IStorage::TYPE_SAVE);
+	if(!m_File)
+		return false;
+
+	m_PendingTicks = 0;
+	m_Size = 0;
+	mem_zero(m_aaLastInput, sizeof(m_aaLastInput));
+
+	AddRaw(ms_aMagic, sizeof(ms_aMagic));
+	AddInt(VERSION);
+	AddInt(MapCrc);
+	AddInt(Seed);
+	AddRaw(pMapName, str_length(pMapName) + 1);
+	return true;
+}
+
+void CInputTraceWriter::Stop()
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	Flush();
+	io_close(m_File);
+	m_File = nullptr;
+}
+
+void CInputTraceWriter::Tick()
+{
+	if(m_File)
+		m_PendingTicks++;
+}
+
+void CInputTraceWriter::Join(int ClientID, bool Sixup, int DDNetVersion, int WaitingTime)
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	AddInt(RECORD_JOIN);
+	AddInt(ClientID);
+	AddInt(Sixup);
+	AddInt(DDNetVersion);
+	AddInt(WaitingTime);
+	mem_zero(m_aaLastInput[ClientID], sizeof(m_aaLastInput[ClientID]));
+}
+
+void CInputTraceWriter::Enter(int ClientID)
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	AddInt(RECORD_ENTER);
+	AddInt(ClientID);
+}
+
+void CInputTraceWriter::Drop(int ClientID, int Type, const char *pReason)
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	AddInt(RECORD_DROP);
+	AddInt(ClientID);
+	AddInt(Type);
+	AddRaw(pReason, str_length(pReason) + 1);
+}
+
+void CInputTraceWriter::Input(int ClientID, int TickOffset, const int *pData, int Size)
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	AddInt(RECORD_INPUT);
+	AddInt(ClientID);
+	AddInt(TickOffset);
+	AddInt(Size);
+
+	// only the ints which changed since the previous input of the client, most inputs only move the cursor
+	int *pLast = m_aaLastInput[ClientID];
+	int NumChanged = 0;
+	for(int i = 0; i < Size; i++)
+		NumChanged += pData[i] != pLast[i];
+	AddInt(NumChanged);
+	int Prev = -1;
+	for(int i = 0; i < Size; i++)
+	{
+		if(pData[i] == pLast[i])
+			continue;
+		AddInt(i - Prev);
+		AddInt((int)((unsigned)pData[i] - (unsigned)pLast[i]));
+		pLast[i] = pData[i];
+		Prev = i;
+	}
+
+	if((int)m_vBuffer.size() >= BUFFER_FLUSH_SIZE)
+		Flush();
+}
+
+void CInputTraceWriter::Message(int ClientID, int Msg, const void *pData, int Size)
+{
+	if(!m_File)
+		return;
+
+	FlushTicks();
+	AddInt(RECORD_MESSAGE);
+	AddInt(ClientID);
+	AddInt(Msg);
+	AddInt(Size);
+	AddRaw(pData, Size);
+
+	if((int)m_vBuffer.size() >= BUFFER_FLUSH_SIZE)
+		Flush();
+}
+
+CInputTraceReader::CInputTraceReader()
+{
+	m_pData = nullptr;
+	m_pCurrent = nullptr;
+	m_pEnd = nullptr;
+	m_Error = false;
+	m_MapCrc = 0;
+	m_Seed = 0;
+	m_aMapName[0] = '\0';
+}
+
+CInputTraceReader::~CInputTraceReader()
+{
+	Close();
+}
+
+int CInputTraceReader::GetInt()
+{
+	if(m_Error)
+		return 0;
+
+	int Value = 0;
+	const unsigned char *pNext = CVariableInt::Unpack(m_pCurrent, &Value, m_pEnd - m_pCurrent);
+	if(!pNext)
+	{
+		m_Error = true;
+		return 0;
+	}
+	m_pCurrent = pNext;
+	return Value;
+}
+
+const unsigned char *CInputTraceReader::GetRaw(int Size)
+{
+	if(m_Error || Size < 0 || Size > m_pEnd - m_pCurrent)
+	{
+		m_Error = true;
+		return nullptr;
+	}
+	const unsigned char *pData = m_pCurrent;
+	m_pCurrent += Size;
+	return pData;
+}
+
+int CInputTraceReader::GetClientID()
+{
+	const int ClientID = GetInt();
+	if(ClientID < 0 || ClientID >= MAX_CLIENTS)
+		m_Error = true;
+	return ClientID;
+}
+
+bool CInputTraceReader::Open(IStorage *pStorage, const char *pFilename, int StorageType)
+{
+	Close();
+
+	IOHANDLE File = pStorage->OpenFile(pFilename, IOFLAG_READ, StorageType);
+	if(!File)
+		return false;
+
+	void *pData;
+	unsigned Size;
+	io_read_all(File, &pData, &Size);
+	io_close(File);
+
+	m_pData = static_cast<unsigned char *>(pData);
+	m_pCurrent = m_pData;
+	m_pEnd = m_pData + Size;
+	m_Error = false;
+	mem_zero(m_aaLastInput, sizeof(m_aaLastInput));
+
+	const unsigned char *pMagic = GetRaw(sizeof(ms_aMagic));
+	if(!pMagic || mem_comp(pMagic, ms_aMagic, sizeof(ms_aMagic)) != 0 || GetInt() != VERSION)
+	{
+		Close();
+		return false;
+	}
+	m_MapCrc = GetInt();
+	m_Seed = GetInt();
+
+	// the map name is null terminated
+	const unsigned char *pName = m_pCurrent;
+	while(m_pCurrent < m_pEnd && *m_pCurrent)
+		m_pCurrent++;
+	if(m_pCurrent == m_pEnd || m_Error)
+	{
+		Close();
+		return false;
+	}
+	str_truncate(m_aMapName, sizeof(m_aMapName), (const char *)pName, m_pCurrent - pName);
+	m_pCurrent++;
+	return true;
+}
+
+void CInputTraceReader::Close()
+{
+	free(m_pData);
+	m_pData = nullptr;
+	m_pCurrent = nullptr;
+	m_pEnd = nullptr;
+}
+
+bool CInputTraceReader::NextRecord(CRecord *pRecord)
+{
+	if(m_Error || m_pCurrent >= m_pEnd)
+		return false;
+
+	pRecord->m_Type = GetInt();
+	switch(pRecord->m_Type)
+	{
+	case RECORD_TICKS:
+		pRecord->m_NumTicks = GetInt();
+		break;
+	case RECORD_JOIN:
+		pRecord->m_ClientID = GetClientID();
+		pRecord->m_Sixup = GetInt() != 0;
+		pRecord->m_DDNetVersion = GetInt();
+		pRecord->m_WaitingTime = GetInt();
+		if(!m_Error)
+			mem_zero(m_aaLastInput[pRecord->m_ClientID], sizeof(m_aaLastInput[pRecord->m_ClientID]));
+		break;
+	case RECORD_ENTER:
+		pRecord->m_ClientID = GetClientID();
+		break;
+	case RECORD_DROP:
+	{
+		pRecord->m_ClientID = GetClientID();
+		pRecord->m_DropType = GetInt();
+		const unsigned char *pReason = m_pCurrent;
+		while(m_pCurrent < m_pEnd && *m_pCurrent)
+			m_pCurrent++;
+		if(m_pCurrent == m_pEnd)
+		{
+			m_Error = true;
+			break;
+		}
+		str_truncate(pRecord->m_aReason, sizeof(pRecord->m_aReason), (const char *)pReason, m_pCurrent - pReason);
+		m_pCurrent++;
+		break;
+	}
+	case RECORD_INPUT:
+	{
+		pRecord->m_ClientID = GetClientID();
+		pRecord->m_TickOffset = GetInt();
+		pRecord->m_Size = GetInt();
+		const int NumChanged = GetInt();
+		if(m_Error || pRecord->m_Size < 0 || pRecord->m_Size > MAX_INPUT_SIZE || NumChanged < 0 || NumChanged > pRecord->m_Size)
+		{
+			m_Error = true;
+			break;
+		}
+		int *pLast = m_aaLastInput[pRecord->m_ClientID];
+		for(int i = 0, Index = -1; i < NumChanged; i++)
+		{
+			// the gap is checked before the sum, a corrupted one would overflow it
+			const int Gap = GetInt();
+			const int Delta = GetInt();
+			if(m_Error || Gap < 1 || Gap > pRecord->m_Size - 1 - Index)
+			{
+				m_Error = true;
+				break;
+			}
+			Index += Gap;
+			pLast[Index] = (int)((unsigned)pLast[Index] + (unsigned)Delta);
+		}
+		mem_copy(pRecord->m_aInput, pLast, sizeof(pRecord->m_aInput));
+		break;
+	}
+	case RECORD_MESSAGE:
+		pRecord->m_ClientID = GetClientID();
+		pRecord->m_Msg = GetInt();
+		pRecord->m_Size = GetInt();
+		pRecord->m_pData = GetRaw(pRecord->m_Size);
+		break;
+	default:
+		m_Error = true;
+	}
+	return !m_Error;
+}
@@ -0,0 +1,131 @@
+#ifndef ENGINE_SHARED_INPUTTRACE_H
+#define ENGINE_SHARED_INPUTTRACE_H
+
+#include <base/system.h>
+
+#include "protocol.h"
+
+#include <vector>
+
+// Trace of everything the clients fed into the game: the joins and drops, the
+// inputs and the game messages, between the ticks. Together with the map and
+// the random seed it is enough to replay a game on a server without sockets.
+//
+// The file starts with the magic, the version, the map crc, the seed and the
+// map name. Then every record starts with its type, followed by its fields.
+// All the ints are packed with CVariableInt.
+//
+// The game messages are stored as sent, except the chat lines with the account
+// commands (login, register, setemail), which only keep the command name. A
+// replay runs them without arguments, so the replayed clients never log in.
+class CInputTrace
+{
+public:
+	enum
+	{
+		VERSION = 1,
+	};
+
+	enum
+	{
+		RECORD_TICKS = 0, // num ticks
+		RECORD_JOIN, // client id, sixup, ddnet version, waiting ticks
+		RECORD_ENTER, // client id
+		RECORD_DROP, // client id, drop type, reason
+		RECORD_INPUT, // client id, intended tick offset, size, num changed ints, (index gap, delta) pairs
+		RECORD_MESSAGE, // client id, message id, size, data
+		NUM_RECORDS
+	};
+
+	static const unsigned char ms_aMagic[8];
+};
+
+class CInputTraceWriter : public CInputTrace
+{
+	IOHANDLE m_File;
+	std::vector<unsigned char> m_vBuffer;
+	int m_PendingTicks;
+	int64_t m_Size;
+	int m_aaLastInput[MAX_CLIENTS][MAX_INPUT_SIZE];
+
+	void AddInt(int Value);
+	void AddRaw(const void *pData, int Size);
+	void FlushTicks();
+	void Flush();
+
+public:
+	CInputTraceWriter();
+	~CInputTraceWriter();
+
+	bool Start(class IStorage *pStorage, const char *pFilename, const char *pMapName, unsigned MapCrc, unsigned Seed);
+	void Stop();
+	bool IsRecording() const { return m_File != nullptr; }
+	int64_t Size() const { return m_Size + m_vBuffer.size(); }
+
+	void Tick();
+	void Join(int ClientID, bool Sixup, int DDNetVersion, int WaitingTime);
+	void Enter(int ClientID);
+	void Drop(int ClientID, int Type, const char *pReason);
+	void Input(int ClientID, int TickOffset, const int *pData, int Size);
+	void Message(int ClientID, int Msg, const void *pData, int Size);
+};
+
+class CInputTraceReader : public CInputTrace
+{
+	unsigned char *m_pData;
+	const unsigned char *m_pCurrent;
+	const unsigned char *m_pEnd;
+	bool m_Error;
+
+	unsigned m_MapCrc;
+	unsigned m_Seed;
+	char m_aMapName[128];
+	int m_aaLastInput[MAX_CLIENTS][MAX_INPUT_SIZE];
+
+	int GetInt();
+	const unsigned char *GetRaw(int Size);
+	int GetClientID();
+
+public:
+	class CRecord
+	{
+	public:
+		int m_Type;
+		int m_ClientID;
+		int m_NumTicks;
+
+		// join
+		bool m_Sixup;
+		int m_DDNetVersion;
+		int m_WaitingTime;
+
+		// drop
+		int m_DropType;
+		char m_aReason[128];
+
+		// input
+		int m_TickOffset;
+		int m_aInput[MAX_INPUT_SIZE];
+
+		// input and message
+		int m_Msg;
+		int m_Size;
+		const unsigned char *m_pData;
+	};
+
+	CInputTraceReader();
+	~CInputTraceReader();
+
+	bool Open(class IStorage *pStorage, const char *pFilename, int StorageType);
+	void Close();
+
+	const char *MapName() const { return m_aMapName; }
+	unsigned MapCrc() const { return m_MapCrc; }
+	unsigned Seed() const { return m_Seed; }
+
+	// returns false at the end of the trace or when it is corrupted, see Error()
+	bool NextRecord(CRecord *pRecord);
+	bool Error() const { return m_Error; }
+};
+
+#endif
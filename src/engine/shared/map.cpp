@@ -60,6 +60,21 @@ bool CMap::Load(const char *pMapName)
 	IStorage *pStorage = Kernel()->RequestInterface<IStorage>();
 	if(!pStorage)
 		return false;
+	return Load(pStorage, pMapName);
+}
+
+bool CMap::LoadMapped(const char *pMapName)
+{
+	IStorage *pStorage = Kernel()->RequestInterface<IStorage>();
+	if(!pStorage)
+		return false;
+	return Load(pStorage, pMapName, true);
+}
+
+bool CMap::Load(IStorage *pStorage, const char *pMapName, bool Mapped)
+{
+	if(Mapped)
+		return m_DataFile.OpenMapped(pStorage, pMapName, IStorage::TYPE_ALL);
 	return m_DataFile.Open(pStorage, pMapName, IStorage::TYPE_ALL);
 }
 
@@ -8,6 +8,8 @@
 #include "datafile.h"
 #include <engine/map.h>
 
+class IStorage;
+
 class CMap : public IEngineMap
 {
 	CDataFileReader m_DataFile;
@@ -28,6 +30,9 @@ public:
 	int NumItems() const override;
 
 	bool Load(const char *pMapName) override;
+	bool LoadMapped(const char *pMapName) override;
+	// Opens the map without the kernel, e.g. on a worker thread
+	bool Load(IStorage *pStorage, const char *pMapName, bool Mapped = false);
 	void Unload() override;
 	bool IsLoaded() const override;
 	IOHANDLE File() const override;
@@ -375,7 +375,7 @@ class CNetServer
 	};
 
 	NETADDR m_Address;
-	NETSOCKET m_Socket;
+	NETSOCKET m_Socket = nullptr;
 	CNetBan *m_pNetBan;
 	CSlot m_aSlots[NET_MAX_CLIENTS];
 	int m_MaxClients;
@@ -397,6 +397,27 @@ class CNetServer
 
 	CSpamConn m_aSpamConns[NET_CONNLIMIT_IPS];
 
+	// open addressing hash map from a client IP to the slots using it,
+	// the slots found still have to be checked for their state
+	struct CAddrSlots
+	{
+		NETADDR m_Addr; // without port
+		uint64_t m_Slots; // bit per slot, empty bucket if zero
+	};
+	enum
+	{
+		ADDR_INDEX_SIZE = NET_MAX_CLIENTS * 4,
+	};
+	static_assert(NET_MAX_CLIENTS <= 64, "slot bitmask too small");
+	CAddrSlots m_aAddrIndex[ADDR_INDEX_SIZE];
+	NETADDR m_aSlotIndexAddr[NET_MAX_CLIENTS];
+	bool m_aSlotIndexed[NET_MAX_CLIENTS];
+
+	static unsigned AddrIndexHash(const NETADDR &Addr);
+	uint64_t AddrIndexSlots(const NETADDR &Addr) const;
+	void IndexSlot(int Slot, const NETADDR &Addr);
+	void UnindexSlot(int Slot);
+
 	CNetRecvUnpacker m_RecvUnpacker;
 
 	void OnTokenCtrlMsg(NETADDR &Addr, int ControlMsg, const CNetPacketConstruct &Packet);
@@ -424,6 +445,8 @@ public:
 	int Recv(CNetChunk *pChunk, SECURITY_TOKEN *pResponseToken);
 	int Send(CNetChunk *pChunk);
 	int Update();
+	// sends the packets queued on the socket, see net_udp_set_send_batching
+	int Flush() { return net_udp_flush(m_Socket); }
 
 	//
 	int Drop(int ClientID, EClientDropType Type, const char *pReason);
@@ -105,10 +105,73 @@ int CNetServer::Drop(int ClientID, EClientDropType Type, const char *pReason)
 		m_pfnDelClient(ClientID, Type, pReason, m_pUser);
 
 	m_aSlots[ClientID].m_Connection.Disconnect(pReason);
+	UnindexSlot(ClientID);
 
 	return 0;
 }
 
+unsigned CNetServer::AddrIndexHash(const NETADDR &Addr)
+{
+	unsigned Hash = 2166136261u ^ Addr.type;
+	for(unsigned char Byte : Addr.ip)
+		Hash = (Hash ^ Byte) * 16777619u;
+	return Hash;
+}
+
+uint64_t CNetServer::AddrIndexSlots(const NETADDR &Addr) const
+{
+	for(unsigned i = AddrIndexHash(Addr) % ADDR_INDEX_SIZE; m_aAddrIndex[i].m_Slots; i = (i + 1) % ADDR_INDEX_SIZE)
+	{
+		if(net_addr_comp_noport(&m_aAddrIndex[i].m_Addr, &Addr) == 0)
+			return m_aAddrIndex[i].m_Slots;
+	}
+	return 0;
+}
+
+void CNetServer::IndexSlot(int Slot, const NETADDR &Addr)
+{
+	UnindexSlot(Slot);
+
+	NETADDR Key = Addr;
+	Key.port = 0;
+	unsigned i = AddrIndexHash(Key) % ADDR_INDEX_SIZE;
+	while(m_aAddrIndex[i].m_Slots && net_addr_comp(&m_aAddrIndex[i].m_Addr, &Key) != 0)
+		i = (i + 1) % ADDR_INDEX_SIZE;
+
+	m_aAddrIndex[i].m_Addr = Key;
+	m_aAddrIndex[i].m_Slots |= (uint64_t)1 << Slot;
+	m_aSlotIndexAddr[Slot] = Key;
+	m_aSlotIndexed[Slot] = true;
+}
+
+void CNetServer::UnindexSlot(int Slot)
+{
+	if(!m_aSlotIndexed[Slot])
+		return;
+	m_aSlotIndexed[Slot] = false;
+
+	unsigned i = AddrIndexHash(m_aSlotIndexAddr[Slot]) % ADDR_INDEX_SIZE;
+	while(net_addr_comp(&m_aAddrIndex[i].m_Addr, &m_aSlotIndexAddr[Slot]) != 0)
+		i = (i + 1) % ADDR_INDEX_SIZE;
+
+	m_aAddrIndex[i].m_Slots &= ~((uint64_t)1 << Slot);
+	if(m_aAddrIndex[i].m_Slots)
+		return;
+
+	// backward shift deletion, keeps the probe sequences without tombstones
+	for(unsigned j = (i + 1) % ADDR_INDEX_SIZE; m_aAddrIndex[j].m_Slots; j = (j + 1) % ADDR_INDEX_SIZE)
+	{
+		unsigned Home = AddrIndexHash(m_aAddrIndex[j].m_Addr) % ADDR_INDEX_SIZE;
+		// move the entry into the hole unless its home lies cyclically in (i, j]
+		if((j > i && (Home <= i || Home > j)) || (j < i && Home <= i && Home > j))
+		{
+			m_aAddrIndex[i] = m_aAddrIndex[j];
+			m_aAddrIndex[j].m_Slots = 0;
+			i = j;
+		}
+	}
+}
+
 int CNetServer::Update()
 {
 	for(int i = 0; i < MaxClients(); i++)
@@ -154,8 +217,12 @@ void CNetServer::SendControl(NETADDR &Addr, int ControlMsg, const void *pExtra,
 int CNetServer::NumClientsWithAddr(NETADDR Addr)
 {
 	int FoundAddr = 0;
-	for(int i = 0; i < MaxClients(); ++i)
+	uint64_t Slots = AddrIndexSlots(Addr);
+	for(int i = 0; Slots; ++i, Slots >>= 1)
 	{
+		if(!(Slots & 1))
+			continue;
+
 		if(m_aSlots[i].m_Connection.State() == NET_CONNSTATE_OFFLINE ||
 			(m_aSlots[i].m_Connection.State() == NET_CONNSTATE_ERROR &&
 				(!m_aSlots[i].m_Connection.m_TimeoutProtected ||
@@ -247,6 +314,7 @@ int CNetServer::TryAcceptClient(NETADDR &Addr, SECURITY_TOKEN SecurityToken, boo
 
 	// init connection slot
 	m_aSlots[Slot].m_Connection.DirectInit(Addr, SecurityToken, Token, Sixup);
+	IndexSlot(Slot, Addr);
 
 	if(VanillaAuth)
 	{
@@ -578,20 +646,23 @@ int CNetServer::OnSixupCtrlMsg(NETADDR &Addr, CNetChunk *pChunk, int ControlMsg,
 
 int CNetServer::GetClientSlot(const NETADDR &Addr)
 {
-	int Slot = -1;
-
-	for(int i = 0; i < MaxClients(); i++)
+	// the last matching slot wins, like the former linear scan
+	uint64_t Slots = AddrIndexSlots(Addr);
+	for(int i = NET_MAX_CLIENTS - 1; Slots; i--)
 	{
+		if(!(Slots & ((uint64_t)1 << i)))
+			continue;
+		Slots &= ~((uint64_t)1 << i);
+
 		if(m_aSlots[i].m_Connection.State() != NET_CONNSTATE_OFFLINE &&
 			m_aSlots[i].m_Connection.State() != NET_CONNSTATE_ERROR &&
 			net_addr_comp(m_aSlots[i].m_Connection.PeerAddress(), &Addr) == 0)
-
 		{
-			Slot = i;
+			return i;
 		}
 	}
 
-	return Slot;
+	return -1;
 }
 
 static bool IsDDNetControlMsg(const CNetPacketConstruct *pPacket)
@@ -802,6 +873,8 @@ bool CNetServer::SetTimedOut(int ClientID, int OrigID)
 
 	m_aSlots[ClientID].m_Connection.SetTimedOut(ClientAddr(OrigID), m_aSlots[OrigID].m_Connection.SeqSequence(), m_aSlots[OrigID].m_Connection.AckSequence(), m_aSlots[OrigID].m_Connection.SecurityToken(), m_aSlots[OrigID].m_Connection.ResendBuffer(), m_aSlots[OrigID].m_Connection.m_Sixup);
 	m_aSlots[OrigID].m_Connection.Reset();
+	IndexSlot(ClientID, *ClientAddr(ClientID));
+	UnindexSlot(OrigID);
 	return true;
 }
 
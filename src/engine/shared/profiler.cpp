@@ -0,0 +1,166 @@
+#include "profiler.h"
+
+#include <base/math.h>
+
+#include <algorithm>
+
+CProfiler::CProfiler()
+{
+	m_vScopes.reserve(MAX_SCOPES);
+	m_Enabled = true;
+	m_TickBudget = 0;
+	m_TraceFile = nullptr;
+	m_TraceStart = 0;
+	m_TraceTicksLeft = 0;
+	m_TraceFirstEvent = true;
+	Reset();
+}
+
+CProfiler::~CProfiler()
+{
+	StopTrace();
+}
+
+int CProfiler::AddScope(const char *pName, int Parent)
+{
+	for(int i = 0; i < NumScopes(); i++)
+	{
+		if(m_vScopes[i].m_Parent == Parent && str_comp(m_vScopes[i].m_pName, pName) == 0)
+			return i;
+	}
+	if(NumScopes() >= MAX_SCOPES)
+		return -1;
+
+	CScope &Scope = m_vScopes.emplace_back();
+	Scope.m_pName = pName;
+	Scope.m_Parent = Parent;
+	Scope.m_Depth = Parent >= 0 ? m_vScopes[Parent].m_Depth + 1 : 0;
+	Scope.m_Start = 0;
+	Scope.m_TickTime = 0;
+	mem_zero(Scope.m_aWindow, sizeof(Scope.m_aWindow));
+	return NumScopes() - 1;
+}
+
+void CProfiler::End(int Scope)
+{
+	if(!m_Enabled)
+		return;
+
+	CScope &Entry = m_vScopes[Scope];
+	const int64_t Duration = time_get_impl() - Entry.m_Start;
+	Entry.m_TickTime += Duration;
+
+	if(m_TraceFile)
+		m_vTraceEvents.push_back({Scope, Entry.m_Start, Duration});
+}
+
+void CProfiler::EndTick()
+{
+	if(!m_Enabled)
+		return;
+
+	int64_t Total = 0;
+	for(auto &Scope : m_vScopes)
+	{
+		Scope.m_aWindow[m_WindowPos] = minimum(Scope.m_TickTime, (int64_t)0xffffffff);
+		if(Scope.m_Parent < 0)
+			Total += Scope.m_TickTime;
+		Scope.m_TickTime = 0;
+	}
+	m_aTotalWindow[m_WindowPos] = minimum(Total, (int64_t)0xffffffff);
+	m_WindowPos = (m_WindowPos + 1) % WINDOW_SIZE;
+	m_NumSamples++;
+	if(m_TickBudget && Total > m_TickBudget)
+		m_NumOverruns++;
+
+	if(m_TraceFile)
+	{
+		FlushTrace();
+		if(--m_TraceTicksLeft <= 0)
+			StopTrace();
+	}
+}
+
+void CProfiler::Reset()
+{
+	for(auto &Scope : m_vScopes)
+	{
+		Scope.m_TickTime = 0;
+		mem_zero(Scope.m_aWindow, sizeof(Scope.m_aWindow));
+	}
+	mem_zero(m_aTotalWindow, sizeof(m_aTotalWindow));
+	m_NumSamples = 0;
+	m_WindowPos = 0;
+	m_NumOverruns = 0;
+}
+
+bool CProfiler::StartTrace(IOHANDLE File, int MaxTicks)
+{
+	StopTrace();
+	if(!File)
+		return false;
+
+	m_TraceFile = File;
+	m_TraceStart = time_get_impl();
+	m_TraceTicksLeft = MaxTicks;
+	m_TraceFirstEvent = true;
+	const char aHeader[] = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	io_write(m_TraceFile, aHeader, str_length(aHeader));
+	return true;
+}
+
+void CProfiler::StopTrace()
+{
+	if(!m_TraceFile)
+		return;
+
+	FlushTrace();
+	const char aFooter[] = "\n]}\n";
+	io_write(m_TraceFile, aFooter, str_length(aFooter));
+	io_close(m_TraceFile);
+	m_TraceFile = nullptr;
+}
+
+void CProfiler::FlushTrace()
+{
+	// chrome://tracing "complete" events, the times are in microseconds
+	char aBuf[256];
+	for(const auto &Event : m_vTraceEvents)
+	{
+		str_format(aBuf, sizeof(aBuf), "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+			m_TraceFirstEvent ? "" : ",\n", m_vScopes[Event.m_Scope].m_pName,
+			(Event.m_Start - m_TraceStart) / 1000.0, Event.m_Duration / 1000.0);
+		io_write(m_TraceFile, aBuf, str_length(aBuf));
+		m_TraceFirstEvent = false;
+	}
+	m_vTraceEvents.clear();
+}
+
+void CProfiler::ComputeStats(const uint32_t *pWindow, int Num, CStats *pStats)
+{
+	mem_zero(pStats, sizeof(*pStats));
+	if(Num <= 0)
+		return;
+
+	uint32_t aSorted[WINDOW_SIZE];
+	mem_copy(aSorted, pWindow, Num * sizeof(*pWindow));
+	std::sort(aSorted, aSorted + Num);
+
+	int64_t Sum = 0;
+	for(int i = 0; i < Num; i++)
+		Sum += aSorted[i];
+	pStats->m_P50 = aSorted[Num / 2];
+	pStats->m_P99 = aSorted[minimum(Num - 1, Num * 99 / 100)];
+	pStats->m_Max = aSorted[Num - 1];
+	pStats->m_Avg = Sum / Num;
+}
+
+void CProfiler::GetStats(int Scope, CStats *pStats) const
+{
+	ComputeStats(m_vScopes[Scope].m_aWindow, minimum(m_NumSamples, (int)WINDOW_SIZE), pStats);
+}
+
+void CProfiler::GetTotalStats(CStats *pStats) const
+{
+	ComputeStats(m_aTotalWindow, minimum(m_NumSamples, (int)WINDOW_SIZE), pStats);
+}
@@ -0,0 +1,135 @@
+#ifndef ENGINE_SHARED_PROFILER_H
+#define ENGINE_SHARED_PROFILER_H
+
+#include <base/system.h>
+
+#include <cstdint>
+#include <vector>
+
+// Measures the time spent in named scopes of the main loop. The times of a
+// scope are summed over a tick and kept for the last WINDOW_SIZE ticks, from
+// which the percentiles are computed. Only to be used from one thread.
+class CProfiler
+{
+public:
+	enum
+	{
+		MAX_SCOPES = 128,
+		WINDOW_SIZE = 1024,
+	};
+
+	struct CStats
+	{
+		int64_t m_P50; // in nanoseconds
+		int64_t m_P99;
+		int64_t m_Max;
+		int64_t m_Avg;
+	};
+
+private:
+	struct CScope
+	{
+		const char *m_pName;
+		int m_Parent;
+		int m_Depth;
+		int64_t m_Start;
+		int64_t m_TickTime;
+		uint32_t m_aWindow[WINDOW_SIZE];
+	};
+
+	struct CTraceEvent
+	{
+		int m_Scope;
+		int64_t m_Start;
+		int64_t m_Duration;
+	};
+
+	std::vector<CScope> m_vScopes;
+	bool m_Enabled;
+
+	int m_NumSamples;
+	int m_WindowPos;
+	int64_t m_TickBudget;
+	uint32_t m_aTotalWindow[WINDOW_SIZE];
+	int m_NumOverruns;
+
+	IOHANDLE m_TraceFile;
+	int64_t m_TraceStart;
+	int m_TraceTicksLeft;
+	bool m_TraceFirstEvent;
+	std::vector<CTraceEvent> m_vTraceEvents;
+
+	void FlushTrace();
+	static void ComputeStats(const uint32_t *pWindow, int Num, CStats *pStats);
+
+public:
+	CProfiler();
+	~CProfiler();
+
+	// returns the existing scope when one with the same name and parent was already added
+	int AddScope(const char *pName, int Parent = -1);
+
+	void SetEnabled(bool Enabled) { m_Enabled = Enabled; }
+	bool IsEnabled() const { return m_Enabled; }
+	void SetTickBudget(int64_t Budget) { m_TickBudget = Budget; }
+
+	void Begin(int Scope)
+	{
+		if(m_Enabled)
+			m_vScopes[Scope].m_Start = time_get_impl();
+	}
+	void End(int Scope);
+
+	// commits the times of the scopes since the previous call as one sample
+	void EndTick();
+	void Reset();
+
+	bool StartTrace(IOHANDLE File, int MaxTicks);
+	void StopTrace();
+	bool IsTracing() const { return m_TraceFile != nullptr; }
+
+	int NumScopes() const { return m_vScopes.size(); }
+	const char *ScopeName(int Scope) const { return m_vScopes[Scope].m_pName; }
+	int ScopeParent(int Scope) const { return m_vScopes[Scope].m_Parent; }
+	int ScopeDepth(int Scope) const { return m_vScopes[Scope].m_Depth; }
+	int NumSamples() const { return m_NumSamples; }
+	int NumOverruns() const { return m_NumOverruns; }
+
+	void GetStats(int Scope, CStats *pStats) const;
+	// sum of the top level scopes
+	void GetTotalStats(CStats *pStats) const;
+
+	// calls Callback(Scope) for all scopes, children after their parent
+	template<typename F>
+	void ForEachScope(F &&Callback, int Parent = -1) const
+	{
+		for(int i = 0; i < NumScopes(); i++)
+		{
+			if(m_vScopes[i].m_Parent != Parent)
+				continue;
+			Callback(i);
+			ForEachScope(Callback, i);
+		}
+	}
+};
+
+class CProfileScope
+{
+	CProfiler *m_pProfiler;
+	int m_Scope;
+
+public:
+	CProfileScope(CProfiler *pProfiler, int Scope) :
+		m_pProfiler(Scope >= 0 ? pProfiler : nullptr), m_Scope(Scope)
+	{
+		if(m_pProfiler)
+			m_pProfiler->Begin(m_Scope);
+	}
+	~CProfileScope()
+	{
+		if(m_pProfiler)
+			m_pProfiler->End(m_Scope);
+	}
+};
+
+#endif
@@ -260,7 +260,10 @@ void CSnapshotDelta::SetStaticsize(int ItemType, int Size)
 {
 	if(ItemType < 0 || ItemType >= MAX_NETOBJSIZES)
 		return;
-	m_aItemSizes[ItemType] = Size;
+	// the sizes are registered again on every map load while other threads may
+	// create deltas, so only write the changes
+	if(m_aItemSizes[ItemType] != Size)
+		m_aItemSizes[ItemType] = Size;
 }
 
 const CSnapshotDelta::CData *CSnapshotDelta::EmptyDelta() const
@@ -269,7 +272,7 @@ const CSnapshotDelta::CData *CSnapshotDelta::EmptyDelta() const
 }
 
 // TODO: OPT: this should be made much faster
-int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pDstData)
+int CSnapshotDelta::CreateDelta(const CSnapshot *pFrom, CSnapshot *pTo, void *pDstData) const
 {
 	CData *pDelta = (CData *)pDstData;
 	int *pData = (int *)pDelta->m_aData;
@@ -579,6 +582,7 @@ int CSnapshotStorage::Get(int Tick, int64_t *pTagtime, const CSnapshot **ppData,
 CSnapshotBuilder::CSnapshotBuilder()
 {
 	m_NumExtendedItemTypes = 0;
+	m_Recording = false;
 }
 
 void CSnapshotBuilder::Init(bool Sixup)
@@ -586,6 +590,7 @@ void CSnapshotBuilder::Init(bool Sixup)
 	m_DataSize = 0;
 	m_NumItems = 0;
 	m_Sixup = Sixup;
+	m_Recording = false;
 
 	for(int i = 0; i < m_NumExtendedItemTypes; i++)
 	{
@@ -668,6 +673,7 @@ void *CSnapshotBuilder::NewItem(int Type, int ID, int Size)
 		return 0;
 	}
 
+	const int OriginalType = Type;
 	bool Extended = false;
 	if(Type >= OFFSET_UUID)
 	{
@@ -696,5 +702,44 @@ void *CSnapshotBuilder::NewItem(int Type, int ID, int Size)
 	m_DataSize += sizeof(CSnapshotItem) + Size;
 	m_NumItems++;
 
+	if(m_Recording)
+		m_vRecordedItems.push_back({OriginalType, ID, Size, (int)((char *)pObj->Data() - m_aData)});
+
 	return pObj->Data();
 }
+
+void CSnapshotBuilder::StartRecording()
+{
+	m_Recording = true;
+	m_vRecordedItems.clear();
+}
+
+void CSnapshotBuilder::StopRecording(CSnapshotItemRecord *pRecord)
+{
+	pRecord->m_vItems.clear();
+	pRecord->m_vData.clear();
+	if(!m_Recording)
+		return;
+
+	// the items are filled after NewItem(), copy them now
+	for(CSnapshotItemRecord::CItem Item : m_vRecordedItems)
+	{
+		const int Offset = Item.m_Offset;
+		Item.m_Offset = pRecord->m_vData.size();
+		pRecord->m_vData.insert(pRecord->m_vData.end(), m_aData + Offset, m_aData + Offset + Item.m_Size);
+		pRecord->m_vItems.push_back(Item);
+	}
+
+	m_Recording = false;
+	m_vRecordedItems.clear();
+}
+
+void CSnapshotBuilder::AddRecord(const CSnapshotItemRecord &Record)
+{
+	for(const CSnapshotItemRecord::CItem &Item : Record.m_vItems)
+	{
+		void *pData = NewItem(Item.m_Type, Item.m_ID, Item.m_Size);
+		if(pData)
+			mem_copy(pData, Record.m_vData.data() + Item.m_Offset, Item.m_Size);
+	}
+}
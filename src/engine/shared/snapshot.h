@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 // CSnapshot
 
@@ -97,7 +98,7 @@ public:
 	int GetDataUpdates(int Index) const { return m_aSnapshotDataUpdates[Index]; }
 	void SetStaticsize(int ItemType, int Size);
 	const CData *EmptyDelta() const;
-	int CreateDelta(const class CSnapshot *pFrom, class CSnapshot *pTo, void *pDstData);
+	int CreateDelta(const class CSnapshot *pFrom, class CSnapshot *pTo, void *pDstData) const;
 	int UnpackDelta(const class CSnapshot *pFrom, class CSnapshot *pTo, const void *pSrcData, int DataSize);
 };
 
@@ -134,6 +135,24 @@ public:
 	int Get(int Tick, int64_t *pTagtime, const CSnapshot **ppData, const CSnapshot **ppAltData);
 };
 
+// CSnapshotItemRecord
+
+// Items captured from a CSnapshotBuilder, to be added again to other snapshots
+class CSnapshotItemRecord
+{
+public:
+	struct CItem
+	{
+		int m_Type;
+		int m_ID;
+		int m_Size;
+		int m_Offset;
+	};
+
+	std::vector<CItem> m_vItems;
+	std::vector<char> m_vData;
+};
+
 class CSnapshotBuilder
 {
 	enum
@@ -156,6 +175,10 @@ class CSnapshotBuilder
 
 	bool m_Sixup;
 
+	// items created since StartRecording(), m_Offset is the offset of their data in m_aData
+	bool m_Recording;
+	std::vector<CSnapshotItemRecord::CItem> m_vRecordedItems;
+
 public:
 	CSnapshotBuilder();
 
@@ -163,6 +186,10 @@ public:
 
 	void *NewItem(int Type, int ID, int Size);
 
+	void StartRecording();
+	void StopRecording(CSnapshotItemRecord *pRecord);
+	void AddRecord(const CSnapshotItemRecord &Record);
+
 	CSnapshotItem *GetItem(int Index);
 	int *GetItemData(int Key);
 
@@ -141,6 +141,7 @@ public:
 			CreateFolder("editor", TYPE_SAVE);
 			CreateFolder("ghosts", TYPE_SAVE);
 			CreateFolder("teehistorian", TYPE_SAVE);
+			CreateFolder("input_traces", TYPE_SAVE);
 		}
 
 		return m_NumPaths ? 0 : 1;
@@ -73,6 +73,14 @@ void CCollision::Init(class CLayers *pLayers)
 	}
 }
 
+void CCollision::InitTiles(CTile *pTiles, int Width, int Height)
+{
+	Dest();
+	m_Width = Width;
+	m_Height = Height;
+	m_pTiles = pTiles;
+}
+
 void CCollision::InitTeleports()
 {
 	if(!m_pLayers->TeleLayer())
@@ -234,14 +242,21 @@ int CCollision::GetTile(int x, int y) const
 }
 
 // TODO: rewrite this smarter!
+// Distance in pixels kept from a tile border when IntersectLine() skips samples,
+// well above the rounding error of the sample positions
+static constexpr double INTERSECT_LINE_MARGIN = 0.25;
+
 int CCollision::IntersectLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision) const
 {
+	// Samples the segment at the same points as the former pixel walk (i / Distance),
+	// but after each sample jumps over the samples that are certainly in the same tile,
+	// so each crossed tile is checked about once.
 	vec2 Pos1Pos0 = Pos1 - Pos0;
 	float Distance = length(Pos1Pos0);
 	int End(Distance+1);
-	vec2 Last = Pos0;
 
-	for(int i = 0; i < End; i++)
+	int i = 0;
+	while(i < End)
 	{
 		float a = i/Distance;
 		vec2 Pos = Pos0 + Pos1Pos0 * a;
@@ -250,10 +265,30 @@ int CCollision::IntersectLine(vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *p
 			if(pOutCollision)
 				*pOutCollision = Pos;
 			if(pOutBeforeCollision)
-				*pOutBeforeCollision = Last;
+				*pOutBeforeCollision = i == 0 ? Pos0 : Pos0 + Pos1Pos0 * ((i - 1) / Distance);
 			return GetCollisionAt(Pos.x, Pos.y);
 		}
-		Last = Pos;
+		if(!m_pTiles)
+			break;
+
+		// the last sample index which stays inside of the current tile
+		double LastInTile = End;
+		const int TileX = clamp(round_to_int(Pos.x) / 32, 0, m_Width - 1);
+		const int TileY = clamp(static_cast<int>(round(Pos.y)) / 32, 0, m_Height - 1);
+		auto Limit = [&](float Start, float Delta, int Tile, int NumTiles) {
+			double Boundary;
+			if(Delta > 0 && Tile < NumTiles - 1)
+				Boundary = (Tile + 1) * 32 - 0.5 - INTERSECT_LINE_MARGIN;
+			else if(Delta < 0 && Tile > 0)
+				Boundary = Tile * 32 - 0.5 + INTERSECT_LINE_MARGIN;
+			else
+				return;
+			LastInTile = minimum(LastInTile, (Boundary - Start) / Delta * Distance);
+		};
+		Limit(Pos0.x, Pos1Pos0.x, TileX, m_Width);
+		Limit(Pos0.y, Pos1Pos0.y, TileY, m_Height);
+
+		i = maximum(i + 1, static_cast<int>(std::floor(LastInTile)) + 1);
 	}
 	if(pOutCollision)
 		*pOutCollision = Pos1;
@@ -430,6 +465,8 @@ void CCollision::Dest()
 	m_pLayers = 0;
 	m_pTele = 0;
 	m_pSpeedup = 0;
+	m_Zones.clear();
+	m_vZoneCaches.clear();
 }
 
 bool CCollision::IsSolid(int x, int y) const
@@ -568,6 +605,8 @@ int CCollision::GetZoneHandle(const char* pName)
 				LayerList.add(l);
 		}
 	}
+
+	BuildZoneCache(Handle);
 	
 	return Handle;
 }
@@ -698,87 +737,238 @@ struct SAnimationTransformCache
 	int PosEnv = -1;
 };
 
-int CCollision::GetZoneValueAt(int ZoneHandle, float x, float y, ZoneData *pData)
+static void GetQuadPoints(const CQuad *pQuad, vec2 Position, float Angle, vec2 *pPoints)
 {
-	if(!m_pLayers->ZoneGroup())
-		return 0;
-	
-	if(ZoneHandle < 0 || ZoneHandle >= m_Zones.size())
-		return 0;
-	
-	int Index = 0;
-	int ExtraData = 0;
+	for(int i = 0; i < 4; i++)
+		pPoints[i] = Position + vec2(fx2f(pQuad->m_aPoints[i].x), fx2f(pQuad->m_aPoints[i].y));
 
-	SAnimationTransformCache AnimationCache;
-	
+	if(Angle != 0)
+	{
+		vec2 center(fx2f(pQuad->m_aPoints[4].x), fx2f(pQuad->m_aPoints[4].y));
+		for(int i = 0; i < 4; i++)
+			Rotate(&center, &pPoints[i], Angle);
+	}
+}
+
+static void GetQuadBox(const vec2 *pPoints, vec2 *pMin, vec2 *pMax)
+{
+	*pMin = *pMax = pPoints[0];
+	for(int i = 1; i < 4; i++)
+	{
+		pMin->x = minimum(pMin->x, pPoints[i].x);
+		pMin->y = minimum(pMin->y, pPoints[i].y);
+		pMax->x = maximum(pMax->x, pPoints[i].x);
+		pMax->y = maximum(pMax->y, pPoints[i].y);
+	}
+}
+
+static bool InsideZoneQuad(const vec2 *pPoints, float x, float y)
+{
+	if(OutOfRange(x, pPoints[0].x, pPoints[1].x, pPoints[2].x, pPoints[3].x))
+		return false;
+	if(OutOfRange(y, pPoints[0].y, pPoints[1].y, pPoints[2].y, pPoints[3].y))
+		return false;
+
+	return InsideQuad(pPoints[0], pPoints[1], pPoints[2], pPoints[3], vec2(x, y));
+}
+
+// The zone cells follow the lookup of the tile layers: clamp(round_to_int(x)/32, 0, Width-1)
+static int ZoneCellCoord(float v, int Size)
+{
+	return clamp(round_to_int(v) / 32, 0, Size - 1);
+}
+
+void CCollision::BuildZoneCache(int ZoneHandle)
+{
+	m_vZoneCaches.resize(m_Zones.size());
+	CZoneCache &Cache = m_vZoneCaches[ZoneHandle];
+
+	Cache.m_Width = maximum(m_Width, 1);
+	Cache.m_Height = maximum(m_Height, 1);
 	for(int i = 0; i < m_Zones[ZoneHandle].size(); i++)
 	{
-		int l = m_Zones[ZoneHandle][i];
-		
-		CMapItemLayer *pLayer = m_pLayers->GetLayer(m_pLayers->ZoneGroup()->m_StartLayer+l);
+		CMapItemLayer *pLayer = m_pLayers->GetLayer(m_pLayers->ZoneGroup()->m_StartLayer + m_Zones[ZoneHandle][i]);
 		if(pLayer->m_Type == LAYERTYPE_TILES)
 		{
 			CMapItemLayerTilemap *pTLayer = (CMapItemLayerTilemap *)pLayer;
-			
-			CTile *pTiles = (CTile *) m_pLayers->Map()->GetData(pTLayer->m_Data);
-			
-			int Nx = clamp(round_to_int(x)/32, 0, pTLayer->m_Width-1);
-			int Ny = clamp(round_to_int(y)/32, 0, pTLayer->m_Height-1);
-			
-			int TileIndex = (pTiles[Ny*pTLayer->m_Width+Nx].m_Index > 128 ? 0 : pTiles[Ny*pTLayer->m_Width+Nx].m_Index);
-			if(TileIndex > 0)
-				Index = TileIndex;
+			Cache.m_Width = maximum(Cache.m_Width, pTLayer->m_Width);
+			Cache.m_Height = maximum(Cache.m_Height, pTLayer->m_Height);
 		}
-		else if(pLayer->m_Type == LAYERTYPE_QUADS)
+	}
+
+	const int Width = Cache.m_Width;
+	const int Height = Cache.m_Height;
+	Cache.m_vCells.assign(Width * Height, CZoneCell());
+	std::vector<std::vector<int>> vvCellQuads(Width * Height);
+
+	// Region of points which fall into a cell, grown to be safe against rounding.
+	// The border cells also get the points outside of the map.
+	constexpr float Margin = 1.0f;
+	constexpr float Infinity = 1e9f;
+	auto CellMin = [](int c) { return c == 0 ? -Infinity : c * 32.0f - 0.5f - Margin; };
+	auto CellMax = [](int c, int Size) { return c == Size - 1 ? Infinity : c * 32.0f + 31.5f + Margin; };
+
+	int Order = 0;
+	for(int i = 0; i < m_Zones[ZoneHandle].size(); i++)
+	{
+		CMapItemLayer *pLayer = m_pLayers->GetLayer(m_pLayers->ZoneGroup()->m_StartLayer + m_Zones[ZoneHandle][i]);
+		if(pLayer->m_Type == LAYERTYPE_TILES)
 		{
-			CMapItemLayerQuads *pQLayer = (CMapItemLayerQuads *)pLayer;
-			
-			const CQuad *pQuads = (const CQuad *) m_pLayers->Map()->GetDataSwapped(pQLayer->m_Data);
+			CMapItemLayerTilemap *pTLayer = (CMapItemLayerTilemap *)pLayer;
+			CTile *pTiles = (CTile *)m_pLayers->Map()->GetData(pTLayer->m_Data);
 
-			for(int q = 0; q < pQLayer->m_NumQuads; q++)
+			for(int y = 0; y < Height; y++)
 			{
-				vec2 Position(0.0f, 0.0f);
-				float Angle = 0.0f;
-				if(pQuads[q].m_PosEnv >= 0)
+				for(int x = 0; x < Width; x++)
 				{
-					if(pQuads[q].m_PosEnv != AnimationCache.PosEnv)
+					int Nx = clamp(x, 0, pTLayer->m_Width - 1);
+					int Ny = clamp(y, 0, pTLayer->m_Height - 1);
+					int TileIndex = (pTiles[Ny * pTLayer->m_Width + Nx].m_Index > 128 ? 0 : pTiles[Ny * pTLayer->m_Width + Nx].m_Index);
+					if(TileIndex > 0)
 					{
-						AnimationCache.PosEnv = pQuads[q].m_PosEnv;
-						GetAnimationTransform(m_Time, AnimationCache.PosEnv, m_pLayers, AnimationCache.Position, AnimationCache.Angle);
+						CZoneCell &Cell = Cache.m_vCells[y * Width + x];
+						Cell.m_Index = TileIndex;
+						Cell.m_IndexOrder = Order;
 					}
-
-					Position = AnimationCache.Position;
-					Angle = AnimationCache.Angle;
 				}
-				
-				vec2 p0 = Position + vec2(fx2f(pQuads[q].m_aPoints[0].x), fx2f(pQuads[q].m_aPoints[0].y));
-				vec2 p1 = Position + vec2(fx2f(pQuads[q].m_aPoints[1].x), fx2f(pQuads[q].m_aPoints[1].y));
-				vec2 p2 = Position + vec2(fx2f(pQuads[q].m_aPoints[2].x), fx2f(pQuads[q].m_aPoints[2].y));
-				vec2 p3 = Position + vec2(fx2f(pQuads[q].m_aPoints[3].x), fx2f(pQuads[q].m_aPoints[3].y));
-				
-				if(Angle != 0)
+			}
+			Order++;
+		}
+		else if(pLayer->m_Type == LAYERTYPE_QUADS)
+		{
+			CMapItemLayerQuads *pQLayer = (CMapItemLayerQuads *)pLayer;
+			const CQuad *pQuads = (const CQuad *)m_pLayers->Map()->GetDataSwapped(pQLayer->m_Data);
+
+			for(int q = 0; q < pQLayer->m_NumQuads; q++, Order++)
+			{
+				CZoneQuad Quad;
+				Quad.m_pQuad = &pQuads[q];
+				Quad.m_Order = Order;
+				GetQuadPoints(&pQuads[q], vec2(0.0f, 0.0f), 0.0f, Quad.m_aPoints);
+				GetQuadBox(Quad.m_aPoints, &Quad.m_BoxMin, &Quad.m_BoxMax);
+
+				if(pQuads[q].m_PosEnv >= 0)
 				{
-					vec2 center(fx2f(pQuads[q].m_aPoints[4].x), fx2f(pQuads[q].m_aPoints[4].y));
-					Rotate(&center, &p0, Angle);
-					Rotate(&center, &p1, Angle);
-					Rotate(&center, &p2, Angle);
-					Rotate(&center, &p3, Angle);
+					Cache.m_vAnimatedQuads.push_back(Quad);
+					continue;
 				}
 
-				if(OutOfRange(x, p0.x, p1.x, p2.x, p3.x))
-					continue;
-				if(OutOfRange(y, p0.y, p1.y, p2.y, p3.y))
-					continue;
-				
-				if(InsideQuad(p0, p1, p2, p3, vec2(x, y)))
+				const int StaticIndex = Cache.m_vStaticQuads.size();
+				Cache.m_vStaticQuads.push_back(Quad);
+
+				const vec2 *pP = Quad.m_aPoints;
+				const int MinX = ZoneCellCoord(Quad.m_BoxMin.x - Margin, Width);
+				const int MaxX = ZoneCellCoord(Quad.m_BoxMax.x + Margin, Width);
+				const int MinY = ZoneCellCoord(Quad.m_BoxMin.y - Margin, Height);
+				const int MaxY = ZoneCellCoord(Quad.m_BoxMax.y + Margin, Height);
+				for(int y = MinY; y <= MaxY; y++)
 				{
-					Index = pQuads[q].m_ColorEnvOffset;
-					ExtraData = pQuads[q].m_aColors[0].g;
+					for(int x = MinX; x <= MaxX; x++)
+					{
+						const vec2 aCorners[4] = {
+							vec2(CellMin(x), CellMin(y)),
+							vec2(CellMax(x, Width), CellMin(y)),
+							vec2(CellMin(x), CellMax(y, Height)),
+							vec2(CellMax(x, Width), CellMax(y, Height)),
+						};
+
+						bool InsideFirst = true;
+						bool InsideSecond = true;
+						for(const vec2 &Corner : aCorners)
+						{
+							InsideFirst = InsideFirst && InsideTriangle(pP[0], pP[1], pP[2], Corner);
+							InsideSecond = InsideSecond && InsideTriangle(pP[1], pP[2], pP[3], Corner);
+						}
+
+						CZoneCell &Cell = Cache.m_vCells[y * Width + x];
+						if(InsideFirst || InsideSecond)
+						{
+							// covers the whole cell, the previous sources do not matter anymore
+							Cell.m_Index = pQuads[q].m_ColorEnvOffset;
+							Cell.m_IndexOrder = Order;
+							Cell.m_ExtraData = pQuads[q].m_aColors[0].g;
+							Cell.m_ExtraDataOrder = Order;
+							vvCellQuads[y * Width + x].clear();
+						}
+						else
+						{
+							vvCellQuads[y * Width + x].push_back(StaticIndex);
+						}
+					}
 				}
 			}
 		}
 	}
 
+	for(int c = 0; c < Width * Height; c++)
+	{
+		Cache.m_vCells[c].m_FirstQuad = Cache.m_vCellQuads.size();
+		Cache.m_vCells[c].m_NumQuads = vvCellQuads[c].size();
+		Cache.m_vCellQuads.insert(Cache.m_vCellQuads.end(), vvCellQuads[c].begin(), vvCellQuads[c].end());
+	}
+}
+
+void CCollision::UpdateZoneAnimations(CZoneCache *pCache)
+{
+	if(pCache->m_AnimationTime == m_Time)
+		return;
+	pCache->m_AnimationTime = m_Time;
+
+	SAnimationTransformCache AnimationCache;
+	for(CZoneQuad &Quad : pCache->m_vAnimatedQuads)
+	{
+		if(Quad.m_pQuad->m_PosEnv != AnimationCache.PosEnv)
+		{
+			AnimationCache.PosEnv = Quad.m_pQuad->m_PosEnv;
+			GetAnimationTransform(m_Time, AnimationCache.PosEnv, m_pLayers, AnimationCache.Position, AnimationCache.Angle);
+		}
+
+		GetQuadPoints(Quad.m_pQuad, AnimationCache.Position, AnimationCache.Angle, Quad.m_aPoints);
+		GetQuadBox(Quad.m_aPoints, &Quad.m_BoxMin, &Quad.m_BoxMax);
+	}
+}
+
+int CCollision::GetZoneValueAt(int ZoneHandle, float x, float y, ZoneData *pData)
+{
+	if(!m_pLayers->ZoneGroup())
+		return 0;
+	
+	if(ZoneHandle < 0 || ZoneHandle >= m_Zones.size())
+		return 0;
+
+	CZoneCache &Cache = m_vZoneCaches[ZoneHandle];
+	const CZoneCell &Cell = Cache.m_vCells[ZoneCellCoord(y, Cache.m_Height) * Cache.m_Width + ZoneCellCoord(x, Cache.m_Width)];
+
+	int Index = Cell.m_Index;
+	int IndexOrder = Cell.m_IndexOrder;
+	int ExtraData = Cell.m_ExtraData;
+	int ExtraDataOrder = Cell.m_ExtraDataOrder;
+
+	auto TestQuad = [&](const CZoneQuad &Quad) {
+		if(Quad.m_Order < ExtraDataOrder)
+			return;
+		if(!InsideZoneQuad(Quad.m_aPoints, x, y))
+			return;
+
+		if(Quad.m_Order > IndexOrder)
+		{
+			Index = Quad.m_pQuad->m_ColorEnvOffset;
+			IndexOrder = Quad.m_Order;
+		}
+		ExtraData = Quad.m_pQuad->m_aColors[0].g;
+		ExtraDataOrder = Quad.m_Order;
+	};
+
+	for(int i = 0; i < Cell.m_NumQuads; i++)
+		TestQuad(Cache.m_vStaticQuads[Cache.m_vCellQuads[Cell.m_FirstQuad + i]]);
+
+	if(!Cache.m_vAnimatedQuads.empty())
+	{
+		UpdateZoneAnimations(&Cache);
+		for(const CZoneQuad &Quad : Cache.m_vAnimatedQuads)
+			TestQuad(Quad);
+	}
+
 	if(pData)
 	{
 		pData->Index = Index;
@@ -798,62 +988,80 @@ bool CCollision::AreConnected(vec2 Pos1, vec2 Pos2, float Radius) const
 	int CenterY = TileRadius;
 	int Width = 2 * TileRadius + 1;
 	int Height = 2 * TileRadius + 1;
-	std::vector<char> vMap(Width * Height);
-	for(int j = 0; j < Height; j++)
+
+	int Pos2X = clamp(CenterX + (int)round((Pos2.x - Pos1.x) / 32.0f), 0, Width - 1);
+	int Pos2Y = clamp(CenterY + (int)round((Pos2.y - Pos1.y) / 32.0f), 0, Height - 1);
+
+	if(Pos2X == CenterX && Pos2Y == CenterY)
+		return true;
+
+	const CConnectivityKey Key(Pos1.x, Pos1.y, Pos2X, Pos2Y, TileRadius);
+	if(m_ConnectivityCacheEnabled)
 	{
-		for(int i = 0; i < Width; i++)
-		{
-			if(CheckPoint(Pos1.x + 32.0f * (i - CenterX), Pos1.y + 32.0f * (j - CenterY)))
-				vMap[j * Width + i] = 0x0; // This tile can be checked
-			else
-				vMap[j * Width + i] = 0x1;
-		}
+		auto It = m_ConnectivityCache.find(Key);
+		if(It != m_ConnectivityCache.end())
+			return It->second;
 	}
 
-	vMap[CenterY * Width + CenterX] = 0x2; // This tile is checked
+	if((int)m_vConnectivityStamps.size() < Width * Height)
+	{
+		m_vConnectivityStamps.assign(Width * Height, 0);
+		m_ConnectivityGeneration = 0;
+	}
+	if(++m_ConnectivityGeneration == 0)
+	{
+		std::fill(m_vConnectivityStamps.begin(), m_vConnectivityStamps.end(), 0);
+		m_ConnectivityGeneration = 1;
+	}
+	const unsigned Generation = m_ConnectivityGeneration;
 
-	int Pos2X = clamp(CenterX + (int)round((Pos2.x - Pos1.x) / 32.0f), 0, Width - 1);
-	int Pos2Y = clamp(CenterY + (int)round((Pos2.y - Pos1.y) / 32.0f), 0, Height - 1);
+	// Flood fill the free tiles around Pos1, starting from its tile
+	m_vConnectivityQueue.clear();
+	m_vConnectivityQueue.push_back(CenterY * Width + CenterX);
+	m_vConnectivityStamps[CenterY * Width + CenterX] = Generation;
 
-	bool Changes = true;
-	while(Changes)
+	const int Target = Pos2Y * Width + Pos2X;
+	bool Connected = false;
+	for(unsigned Next = 0; Next < m_vConnectivityQueue.size() && !Connected; Next++)
 	{
-		Changes = false;
-		for(int j = 0; j < Height; j++)
+		const int Index = m_vConnectivityQueue[Next];
+		const int i = Index % Width;
+		const int j = Index / Width;
+		const int aNeighbours[4] = {
+			i > 0 ? Index - 1 : -1,
+			j > 0 ? Index - Width : -1,
+			i < Width - 1 ? Index + 1 : -1,
+			j < Height - 1 ? Index + Width : -1,
+		};
+
+		for(int Neighbour : aNeighbours)
 		{
-			for(int i = 0; i < Width; i++)
+			if(Neighbour < 0 || m_vConnectivityStamps[Neighbour] == Generation)
+				continue;
+
+			m_vConnectivityStamps[Neighbour] = Generation;
+			const int x = Neighbour % Width;
+			const int y = Neighbour / Width;
+			if(CheckPoint(Pos1.x + 32.0f * (x - CenterX), Pos1.y + 32.0f * (y - CenterY)))
+				continue;
+
+			if(Neighbour == Target)
 			{
-				if(vMap[j * Width + i] & 0x1 && !(vMap[j * Width + i] & 0x2))
-				{
-					if(i > 0 && (vMap[j * Width + (i - 1)] & 0x2))
-					{
-						vMap[j * Width + i] = 0x2;
-						Changes = true;
-					}
-					if(j > 0 && (vMap[(j - 1) * Width + i] & 0x2))
-					{
-						vMap[j * Width + i] = 0x2;
-						Changes = true;
-					}
-					if(i < Width - 1 && (vMap[j * Width + (i + 1)] & 0x2))
-					{
-						vMap[j * Width + i] = 0x2;
-						Changes = true;
-					}
-					if(j < Height - 1 && (vMap[(j + 1) * Width + i] & 0x2))
-					{
-						vMap[j * Width + i] = 0x2;
-						Changes = true;
-					}
-				}
+				Connected = true;
+				break;
 			}
-		}
-
-		if(vMap[Pos2Y * Width + Pos2X] & 0x2)
-		{
-			return true;
+			m_vConnectivityQueue.push_back(Neighbour);
 		}
 	}
 
-	return false;
+	if(m_ConnectivityCacheEnabled)
+		m_ConnectivityCache[Key] = Connected;
+
+	return Connected;
+}
+
+void CCollision::ResetConnectivityCache(bool Enabled)
+{
+	m_ConnectivityCacheEnabled = Enabled;
+	m_ConnectivityCache.clear();
 }
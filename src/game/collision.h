@@ -7,6 +7,7 @@
 #include <base/tl/array.h>
 
 #include <map>
+#include <tuple>
 #include <vector>
 
 enum
@@ -29,6 +30,46 @@ struct ZoneData
 
 class CCollision
 {
+	// Zone lookup cache. The zone layers are rasterized at load into a grid using the
+	// same cells as the zone tile layers. Each cell keeps the value of the static sources
+	// which cover it completely, and the static quads which only cover it partially.
+	// Animated quads are transformed once per game time in a separate list.
+	// Every source has an order number, the one with the highest order wins.
+	// A cell takes 24 bytes, so a zone handle costs about Width*Height*24 bytes
+	// (2.4 MB for a 500x200 map) plus the quad lists.
+	class CZoneQuad
+	{
+	public:
+		const struct CQuad *m_pQuad;
+		vec2 m_aPoints[4];
+		vec2 m_BoxMin;
+		vec2 m_BoxMax;
+		int m_Order;
+	};
+
+	class CZoneCell
+	{
+	public:
+		int m_Index = 0;
+		int m_IndexOrder = -1;
+		int m_ExtraData = 0;
+		int m_ExtraDataOrder = -1;
+		int m_FirstQuad = 0;
+		int m_NumQuads = 0;
+	};
+
+	class CZoneCache
+	{
+	public:
+		int m_Width = 0;
+		int m_Height = 0;
+		std::vector<CZoneCell> m_vCells;
+		std::vector<CZoneQuad> m_vStaticQuads;
+		std::vector<int> m_vCellQuads;
+		std::vector<CZoneQuad> m_vAnimatedQuads;
+		double m_AnimationTime = -1.0;
+	};
+
 	class CTile *m_pTiles;
 	int m_Width;
 	int m_Height;
@@ -37,6 +78,20 @@ class CCollision
 	double m_Time;
 	
 	array< array<int> > m_Zones;
+	std::vector<CZoneCache> m_vZoneCaches;
+
+	void BuildZoneCache(int ZoneHandle);
+	void UpdateZoneAnimations(CZoneCache *pCache);
+
+	// AreConnected() scratch buffers, a tile is visited when its stamp is the current generation
+	mutable std::vector<unsigned> m_vConnectivityStamps;
+	mutable std::vector<int> m_vConnectivityQueue;
+	mutable unsigned m_ConnectivityGeneration = 0;
+	// AreConnected() results of the current tick, keyed by the start position,
+	// the target tile offset and the tile radius
+	typedef std::tuple<float, float, int, int, int> CConnectivityKey;
+	mutable std::map<CConnectivityKey, bool> m_ConnectivityCache;
+	bool m_ConnectivityCacheEnabled = false;
 
 	bool IsSolid(int x, int y) const;
 	int GetTile(int x, int y) const;
@@ -52,6 +107,8 @@ public:
 	CCollision();
 	~CCollision();
 	void Init(class CLayers *pLayers);
+	// Uses a bare game layer without the map, e.g. in the tests
+	void InitTiles(class CTile *pTiles, int Width, int Height);
 	void InitTeleports();
 
 	bool CheckPoint(float x, float y) const { return IsSolid(round_to_int(x), round(y)); }
@@ -83,6 +140,7 @@ public:
 	
 /* INFECTION MODIFICATION START ***************************************/
 	bool AreConnected(vec2 Pos1, vec2 Pos2, float Radius) const;
+	void ResetConnectivityCache(bool Enabled);
 /* INFECTION MODIFICATION END *****************************************/
 
 	int GetPureMapIndex(float x, float y) const;
@@ -7,6 +7,8 @@
 
 #include <engine/shared/config.h>
 
+#include <bit>
+
 const char *CTuningParams::ms_apNames[] =
 {
 	#define MACRO_TUNING_PARAM(Name, ScriptName, Value, Description) #ScriptName,
@@ -99,6 +101,20 @@ void CCharacterCore::Reset()
 	m_Input.m_TargetY = -1;
 }
 
+static_assert(MAX_CLIENTS <= 64, "the character masks are 64 bits");
+
+uint64_t CWorldCore::CharactersInBox(vec2 Min, vec2 Max) const
+{
+	uint64_t Mask = 0;
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		const CCharacterCore *pCharCore = m_apCharacters[i];
+		if(pCharCore && pCharCore->m_Pos.x >= Min.x && pCharCore->m_Pos.x <= Max.x && pCharCore->m_Pos.y >= Min.y && pCharCore->m_Pos.y <= Max.y)
+			Mask |= (uint64_t)1 << i;
+	}
+	return Mask;
+}
+
 void CCharacterCore::Tick(bool UseInput, CParams* pParams)
 {
 	bool DoDeferredTick = true;
@@ -267,9 +283,14 @@ void CCharacterCore::Tick(bool UseInput, CParams* pParams)
 		// Check against other players first
 		if(m_pWorld)
 		{
+			// the hooked characters are closer than PhysicalSize() + 2 to the hook segment
+			const vec2 Margin(PhysicalSize() + 3.0f, PhysicalSize() + 3.0f);
+			const vec2 SegmentMin(minimum(m_HookPos.x, NewPos.x), minimum(m_HookPos.y, NewPos.y));
+			const vec2 SegmentMax(maximum(m_HookPos.x, NewPos.x), maximum(m_HookPos.y, NewPos.y));
 			float Distance = 0.0f;
-			for(int i = 0; i < MAX_CLIENTS; i++)
+			for(uint64_t Mask = m_pWorld->CharactersInBox(SegmentMin - Margin, SegmentMax + Margin); Mask; Mask &= Mask - 1)
 			{
+				const int i = std::countr_zero(Mask);
 				CCharacterCore *pCharCore = m_pWorld->m_apCharacters[i];
 				if (IsRecursePassenger(pCharCore))
 					continue;
@@ -383,11 +404,17 @@ void CCharacterCore::TickDeferred(CParams *pParams)
 
 	if(m_pWorld)
 	{
-		for(int i = 0; i < MAX_CLIENTS; i++)
+		// the collision needs a distance below PhysicalSize() * 1.25f, the hook
+		// influence applies to the hooked player whatever the distance
+		const vec2 Margin(PhysicalSize() * 1.25f + 1.0f, PhysicalSize() * 1.25f + 1.0f);
+		uint64_t Candidates = m_pWorld->CharactersInBox(m_Pos - Margin, m_Pos + Margin);
+		if(m_HookedPlayer >= 0 && m_pWorld->m_apCharacters[m_HookedPlayer])
+			Candidates |= (uint64_t)1 << m_HookedPlayer;
+
+		for(uint64_t Mask = Candidates; Mask; Mask &= Mask - 1)
 		{
+			const int i = std::countr_zero(Mask);
 			CCharacterCore *pCharCore = m_pWorld->m_apCharacters[i];
-			if(!pCharCore)
-				continue;
 
 			//player *p = (player*)ent;
 			//if(pCharCore == this) // || !(p->flags&FLAG_ALIVE)
@@ -491,16 +518,25 @@ void CCharacterCore::Move(CParams* pParams)
 		float Distance = distance(m_Pos, NewPos);
 		if(Distance > 0)
 		{
+			// the blocking characters are closer than 28 to the path
+			const vec2 Margin(29.0f, 29.0f);
+			const vec2 PathMin(minimum(m_Pos.x, NewPos.x), minimum(m_Pos.y, NewPos.y));
+			const vec2 PathMax(maximum(m_Pos.x, NewPos.x), maximum(m_Pos.y, NewPos.y));
+			uint64_t Candidates = m_pWorld->CharactersInBox(PathMin - Margin, PathMax + Margin);
+			if(m_Id >= 0 && m_pWorld->m_apCharacters[m_Id] == this)
+				Candidates &= ~((uint64_t)1 << m_Id);
+
 			int End = Distance + 1;
 			vec2 LastPos = m_Pos;
-			for(int i = 0; i < End; i++)
+			for(int i = 0; i < End && Candidates; i++)
 			{
 				float a = i / Distance;
 				vec2 Pos = mix(m_Pos, NewPos, a);
-				for(int p = 0; p < MAX_CLIENTS; p++)
+				for(uint64_t Mask = Candidates; Mask; Mask &= Mask - 1)
 				{
+					const int p = std::countr_zero(Mask);
 					CCharacterCore *pCharCore = m_pWorld->m_apCharacters[p];
-					if(!pCharCore || pCharCore == this)
+					if(pCharCore == this)
 						continue;
 					if((!(pCharCore->m_Super || m_Super) && (m_Solo || pCharCore->m_Solo || (m_Id != -1 && !m_pTeams->CanCollide(m_Id, p)))))
 						continue;
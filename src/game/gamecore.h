@@ -204,6 +204,12 @@ public:
 
 	CTuningParams m_Tuning;
 	class CCharacterCore *m_apCharacters[MAX_CLIENTS];
+
+	// Broadphase for the player vs player tests: bit i is set when the character i
+	// is inside the box. The positions change during the tick, so the mask is built
+	// from the current ones and only used to skip the exact tests, which keeps the
+	// physics identical.
+	uint64_t CharactersInBox(vec2 Min, vec2 Max) const;
 };
 
 class CCharacterCore
@@ -0,0 +1,61 @@
+/* (c) Magnus Auvinen. See licence.txt in the root of the distribution for more information. */
+/* If you are missing that file, acquire a complete release at teeworlds.com.                */
+#include "alloc.h"
+
+#include <base/math.h>
+
+CSlabAllocator::~CSlabAllocator()
+{
+	for(void *pSlab : m_vpSlabs)
+		free(pSlab);
+}
+
+void *CSlabAllocator::Allocate(size_t Size)
+{
+	if(Size > MAX_OBJECT_SIZE)
+		return malloc(Size);
+
+	const int Class = SizeClass(Size);
+	CSizeClassStats &Stats = m_aStats[Class];
+	if(!m_apFreeLists[Class])
+	{
+		// carve a new slab into blocks of this size class
+		const int BlockSize = (Class + 1) * GRANULARITY;
+		const int NumBlocks = maximum(1, SLAB_SIZE / BlockSize);
+		char *pSlab = (char *)malloc(NumBlocks * BlockSize);
+		m_vpSlabs.push_back(pSlab);
+		Stats.m_NumSlabs++;
+
+		for(int i = NumBlocks - 1; i >= 0; i--)
+		{
+			CFreeBlock *pBlock = (CFreeBlock *)(pSlab + i * BlockSize);
+			pBlock->m_pNext = m_apFreeLists[Class];
+			m_apFreeLists[Class] = pBlock;
+		}
+	}
+
+	CFreeBlock *pBlock = m_apFreeLists[Class];
+	m_apFreeLists[Class] = pBlock->m_pNext;
+
+	Stats.m_NumLive++;
+	Stats.m_MaxLive = maximum(Stats.m_MaxLive, Stats.m_NumLive);
+	return pBlock;
+}
+
+void CSlabAllocator::Free(void *pPtr, size_t Size)
+{
+	if(!pPtr)
+		return;
+
+	if(Size > MAX_OBJECT_SIZE)
+	{
+		free(pPtr);
+		return;
+	}
+
+	const int Class = SizeClass(Size);
+	CFreeBlock *pBlock = (CFreeBlock *)pPtr;
+	pBlock->m_pNext = m_apFreeLists[Class];
+	m_apFreeLists[Class] = pBlock;
+	m_aStats[Class].m_NumLive--;
+}
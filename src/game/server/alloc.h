@@ -7,6 +7,54 @@
 
 #include <base/system.h>
 
+#include <vector>
+
+/*
+	Class: CSlabAllocator
+		Allocates small objects from slabs, with a free list per
+		size class. Freed blocks are reused by the next objects of the
+		same size and the slabs are only released with the allocator.
+		It is not thread safe.
+*/
+class CSlabAllocator
+{
+public:
+	enum
+	{
+		GRANULARITY = 16,
+		NUM_SIZE_CLASSES = 128,
+		MAX_OBJECT_SIZE = GRANULARITY * NUM_SIZE_CLASSES,
+		SLAB_SIZE = 32 * 1024,
+	};
+
+	class CSizeClassStats
+	{
+	public:
+		int m_NumLive = 0;
+		int m_MaxLive = 0;
+		int m_NumSlabs = 0;
+	};
+
+	~CSlabAllocator();
+
+	void *Allocate(size_t Size);
+	void Free(void *pPtr, size_t Size);
+
+	static int SizeClass(size_t Size) { return (Size + GRANULARITY - 1) / GRANULARITY - 1; }
+	const CSizeClassStats &Stats(int SizeClass) const { return m_aStats[SizeClass]; }
+	int NumSlabs() const { return m_vpSlabs.size(); }
+
+private:
+	struct CFreeBlock
+	{
+		CFreeBlock *m_pNext;
+	};
+
+	CFreeBlock *m_apFreeLists[NUM_SIZE_CLASSES] = {};
+	CSizeClassStats m_aStats[NUM_SIZE_CLASSES];
+	std::vector<void *> m_vpSlabs;
+};
+
 #define MACRO_ALLOC_HEAP() \
 public: \
 	void *operator new(size_t Size) \
@@ -22,6 +70,21 @@ public: \
 \
 private:
 
+#define MACRO_ALLOC_SLAB(ALLOCATOR) \
+public: \
+	void *operator new(size_t Size) \
+	{ \
+		void *p = ALLOCATOR.Allocate(Size); \
+		mem_zero(p, Size); \
+		return p; \
+	} \
+	void operator delete(void *pPtr, size_t Size) \
+	{ \
+		ALLOCATOR.Free(pPtr, Size); \
+	} \
+\
+private:
+
 #define MACRO_ALLOC_POOL_ID() \
 public: \
 	void *operator new(size_t Size, int id); \
@@ -11,6 +11,10 @@
 //////////////////////////////////////////////////
 // Entity
 //////////////////////////////////////////////////
+CSlabAllocator CEntity::ms_Allocator;
+int CEntity::ms_aNumLive[CGameWorld::NUM_ENTTYPES] = {0};
+int CEntity::ms_aMaxLive[CGameWorld::NUM_ENTTYPES] = {0};
+
 CEntity::CEntity(CGameWorld *pGameWorld, int ObjType, const vec2 &Pos, int ProximityRadius)
 {
 	m_pGameWorld = pGameWorld;
@@ -25,12 +29,28 @@ CEntity::CEntity(CGameWorld *pGameWorld, int ObjType, const vec2 &Pos, int Proxi
 
 	m_pPrevTypeEntity = 0;
 	m_pNextTypeEntity = 0;
+	m_DenseIndex = -1;
+
+	m_GridCell = -1;
+	m_pPrevCellEntity = nullptr;
+	m_pNextCellEntity = nullptr;
+
+	ms_aNumLive[m_ObjType]++;
+	ms_aMaxLive[m_ObjType] = maximum(ms_aMaxLive[m_ObjType], ms_aNumLive[m_ObjType]);
 }
 
 CEntity::~CEntity()
 {
 	GameWorld()->RemoveEntity(this);
 	Server()->SnapFreeID(m_ID);
+	ms_aNumLive[m_ObjType]--;
+}
+
+void CEntity::SetPos(const vec2 &Pos)
+{
+	m_Pos = Pos;
+	if(m_GridCell >= 0)
+		m_pGameWorld->OnEntityMoved(this);
 }
 
 bool CEntity::NetworkClipped(int SnappingClient) const
@@ -98,6 +118,41 @@ bool NetworkClippedLine(const CGameContext *pGameServer, int SnappingClient, vec
 	return (absolute(DistanceToLine.x) > ClippDistance || absolute(DistanceToLine.y) > ClippDistance);
 }
 
+bool CSnapItemCache::Begin(IServer *pServer, int SnappingClient, int Variant)
+{
+	// 0.7 clients get translated items
+	const int Key = Variant * 2 + (pServer->IsSixup(SnappingClient) ? 1 : 0);
+	const int Tick = pServer->Tick();
+
+	CVariant *pSlot = nullptr;
+	for(CVariant &Slot : m_aVariants)
+	{
+		if(Slot.m_Key == Key && Slot.m_Tick == Tick)
+		{
+			pServer->SnapAddRecord(Slot.m_Record);
+			return false;
+		}
+		if(!pSlot || Slot.m_Key == Key || (pSlot->m_Key != Key && Slot.m_Tick < pSlot->m_Tick))
+			pSlot = &Slot;
+	}
+
+	pSlot->m_Key = Key;
+	pSlot->m_Tick = -1;
+	m_pRecording = pSlot;
+	pServer->SnapStartRecording();
+	return true;
+}
+
+void CSnapItemCache::End(IServer *pServer)
+{
+	if(!m_pRecording)
+		return;
+
+	pServer->SnapStopRecording(&m_pRecording->m_Record);
+	m_pRecording->m_Tick = pServer->Tick();
+	m_pRecording = nullptr;
+}
+
 CAnimatedEntity::CAnimatedEntity(CGameWorld *pGameWorld, int Objtype, vec2 Pivot) :
 	CEntity(pGameWorld, Objtype),
 	m_Pivot(Pivot),
@@ -128,5 +183,5 @@ void CAnimatedEntity::Tick()
 	float x = (m_RelPosition.x * cosf(Angle) - m_RelPosition.y * sinf(Angle));
 	float y = (m_RelPosition.x * sinf(Angle) + m_RelPosition.y * cosf(Angle));
 	
-	m_Pos = Position + m_Pivot + vec2(x, y);
+	SetPos(Position + m_Pivot + vec2(x, y));
 }
@@ -5,11 +5,13 @@
 
 #include <new>
 #include <base/vmath.h>
+#include <engine/shared/snapshot.h>
 #include <game/server/gameworld.h>
 
 #include "alloc.h"
 
 class CCollision;
+class IServer;
 
 /*
 	Class: Entity
@@ -17,11 +19,22 @@ class CCollision;
 */
 class CEntity
 {
-	MACRO_ALLOC_HEAP()
+	MACRO_ALLOC_SLAB(ms_Allocator)
+
+	static CSlabAllocator ms_Allocator;
+	static int ms_aNumLive[CGameWorld::NUM_ENTTYPES];
+	static int ms_aMaxLive[CGameWorld::NUM_ENTTYPES];
 
 	friend class CGameWorld;	// entity list handling
 	CEntity *m_pPrevTypeEntity;
 	CEntity *m_pNextTypeEntity;
+	// slot in the dense storage of the world, -1 when not inserted
+	int m_DenseIndex;
+
+	// spatial index of the world
+	int m_GridCell;
+	CEntity *m_pPrevCellEntity;
+	CEntity *m_pNextCellEntity;
 
 	/* Identity */
 	CGameWorld *m_pGameWorld;
@@ -40,6 +53,11 @@ public:
 	/* Destructor */
 	virtual ~CEntity();
 	
+	/* Allocation statistics */
+	static const CSlabAllocator &Allocator() { return ms_Allocator; }
+	static int NumLive(int Type) { return ms_aNumLive[Type]; }
+	static int MaxLive(int Type) { return ms_aMaxLive[Type]; }
+
 	/* Objects */
 	class CGameWorld *GameWorld() { return m_pGameWorld; }
 	class CConfig *Config() { return m_pGameWorld->Config(); }
@@ -51,12 +69,14 @@ public:
 	/* Getters */
 	CEntity *TypeNext() { return m_pNextTypeEntity; }
 	CEntity *TypePrev() { return m_pPrevTypeEntity; }
+	int GetObjType() const { return m_ObjType; }
 	vec2 GetPos() const { return m_Pos; }
 	float GetProximityRadius() const { return m_ProximityRadius; }
 	bool IsMarkedForDestroy() const { return m_MarkedForDestroy; }
 
 	/* Setters */
 	void MarkForDestroy() { m_MarkedForDestroy = true; }
+	void SetPos(const vec2 &Pos);
 
 	/* Other functions */
 
@@ -134,6 +154,7 @@ public:
 	/*
 		Variable: pos
 			Contains the current posititon of the entity.
+			Use SetPos() to move the entity to keep the world spatial index valid.
 	*/
 	vec2 m_Pos;
 };
@@ -149,6 +170,46 @@ std::optional<CViewParams> GetViewParams(const CGameContext *pGameServer, int Sn
 bool NetworkClipped(const CGameContext *pGameServer, int SnappingClient, vec2 CheckPos);
 bool NetworkClippedLine(const CGameContext *pGameServer, int SnappingClient, vec2 StartPos, vec2 EndPos);
 
+/*
+	Class: CSnapItemCache
+		Keeps the snapshot items of an entity which are the same for all
+		clients. They are built for the first client of a snapshot and
+		copied for the next ones. The variant separates the clients which
+		get different items, e.g. the laser objects of old clients.
+
+		Usage:
+			if(m_SnapCache.Begin(Server(), SnappingClient, Variant))
+			{
+				// snap the items
+				m_SnapCache.End(Server());
+			}
+*/
+class CSnapItemCache
+{
+public:
+	bool Begin(IServer *pServer, int SnappingClient, int Variant = 0);
+	void End(IServer *pServer);
+
+private:
+	enum
+	{
+		// the laser variant and the anti ping setting of the turrets and the
+		// scientist mines, for the 0.6 and the 0.7 clients
+		MAX_VARIANTS = 2 * 2 * 2,
+	};
+
+	class CVariant
+	{
+	public:
+		int m_Tick = -1;
+		int m_Key = -1;
+		CSnapshotItemRecord m_Record;
+	};
+
+	CVariant m_aVariants[MAX_VARIANTS];
+	CVariant *m_pRecording = nullptr;
+};
+
 class CAnimatedEntity : public CEntity
 {
 protected:
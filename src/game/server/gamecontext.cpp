@@ -12,6 +12,7 @@
 #include <engine/server/sql_server.h>
 #include <engine/shared/json.h>
 #include <engine/shared/linereader.h>
+#include <engine/shared/profiler.h>
 #include "gamecontext.h"
 #include <game/version.h>
 #include <game/collision.h>
@@ -473,42 +474,106 @@ void CGameContext::SendChatTarget(int To, const char *pText)
 }
 
 /* INFECTION MODIFICATION START ***************************************/
-void CGameContext::SendChatTarget_Localization(int To, int Category, const char* pText, ...)
+template<typename FFormat, typename FSend>
+void CGameContext::SendLocalized(int To, FFormat &&Format, FSend &&Send)
 {
 	int Start = (To < 0 ? 0 : To);
 	int End = (To < 0 ? MAX_CLIENTS : To+1);
-	
+
+	bool aHandled[MAX_CLIENTS] = {false};
+	int aClientIDs[MAX_CLIENTS];
+	dynamic_string Buffer;
+
+	for(int i = Start; i < End; i++)
+	{
+		if(!m_apPlayers[i] || aHandled[i])
+			continue;
+
+		// collect the receivers which share the language of this one
+		const char *pLanguage = m_apPlayers[i]->GetLanguage();
+		const int LanguageID = m_apPlayers[i]->GetLanguageID();
+		int NumClients = 0;
+		for(int j = i; j < End; j++)
+		{
+			if(m_apPlayers[j] && !aHandled[j] && m_apPlayers[j]->GetLanguageID() == LanguageID)
+			{
+				aHandled[j] = true;
+				aClientIDs[NumClients++] = j;
+			}
+		}
+
+		Buffer.clear();
+		Format(Buffer, pLanguage);
+		Send(Buffer.buffer(), aClientIDs, NumClients);
+
+		m_LocalizedFormats++;
+		m_LocalizedReceivers += NumClients;
+	}
+}
+
+void CGameContext::SendChatPacked(const char *pText, const int *pClientIDs, int NumClients)
+{
+	CNetMsg_Sv_Chat Msg;
+	Msg.m_Team = 0;
+	Msg.m_ClientID = -1;
+	Msg.m_pMessage = pText;
+	CMsgPacker Packer(Msg.ms_MsgID, false);
+	if(Msg.Pack(&Packer))
+		return;
+
+	protocol7::CNetMsg_Sv_Chat Msg7;
+	Msg7.m_Mode = protocol7::CHAT_ALL;
+	Msg7.m_ClientID = -1;
+	Msg7.m_TargetID = -1;
+	Msg7.m_pMessage = pText;
+	CMsgPacker Packer7(Msg7.ms_MsgID, false, true);
+	bool Packed7 = false;
+
+	for(int i = 0; i < NumClients; i++)
+	{
+		int ClientID = pClientIDs[i];
+		if(Server()->IsSixup(ClientID))
+		{
+			if(!Packed7)
+			{
+				if(Msg7.Pack(&Packer7))
+					continue;
+				Packed7 = true;
+			}
+			Server()->SendMsg(&Packer7, MSGFLAG_VITAL | MSGFLAG_NORECORD, ClientID);
+		}
+		else
+		{
+			Server()->SendMsg(&Packer, MSGFLAG_VITAL | MSGFLAG_NORECORD, ClientID);
+		}
+	}
+}
+
+void CGameContext::SendChatTarget_Localization(int To, int Category, const char* pText, ...)
+{
 	CNetMsg_Sv_Chat Msg;
 	Msg.m_Team = 0;
 	Msg.m_ClientID = -1;
-	
-	dynamic_string Buffer;
 	
 	va_list VarArgs;
 	va_start(VarArgs, pText);
 
 	bool Sent = false;
-	for(int i = Start; i < End; i++)
-	{
-		if(m_apPlayers[i])
-		{
-			Buffer.clear();
+	SendLocalized(To,
+		[&](dynamic_string &Buffer, const char *pLanguage) {
 			Buffer.append(GetChatCategoryPrefix(Category));
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
-			
-			Msg.m_pMessage = Buffer.buffer();
-			Server()->SendPackMsg(&Msg, MSGFLAG_VITAL|MSGFLAG_NORECORD, i);
+			Server()->Localization()->Format_VL(Buffer, pLanguage, pText, VarArgs);
+		},
+		[&](const char *pMessage, const int *pClientIDs, int NumClients) {
+			SendChatPacked(pMessage, pClientIDs, NumClients);
 			Sent = true;
-		}
-	}
+		});
 
 	if(To < 0 && Sent)
 	{
-		Buffer.clear();
-		Buffer.append(GetChatCategoryPrefix(Category));
 		// one message for record
 		dynamic_string tmpBuf;
-		tmpBuf.copy(Buffer);
+		tmpBuf.append(GetChatCategoryPrefix(Category));
 		Server()->Localization()->Format_VL(tmpBuf, "en", pText, VarArgs);
 		Msg.m_pMessage = tmpBuf.buffer();
 		Server()->SendPackMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_NOSEND, -1);
@@ -523,40 +588,29 @@ void CGameContext::SendChatTarget_Localization(int To, int Category, const char*
 
 void CGameContext::SendChatTarget_Localization_P(int To, int Category, int Number, const char* pText, ...)
 {
-	int Start = (To < 0 ? 0 : To);
-	int End = (To < 0 ? MAX_CLIENTS : To+1);
-	
 	CNetMsg_Sv_Chat Msg;
 	Msg.m_Team = 0;
 	Msg.m_ClientID = -1;
 	
-	dynamic_string Buffer;
-	
 	va_list VarArgs;
 	va_start(VarArgs, pText);
 
 	bool Sent = false;
-	for(int i = Start; i < End; i++)
-	{
-		if(m_apPlayers[i])
-		{
-			Buffer.clear();
+	SendLocalized(To,
+		[&](dynamic_string &Buffer, const char *pLanguage) {
 			Buffer.append(GetChatCategoryPrefix(Category));
-			Server()->Localization()->Format_VLP(Buffer, m_apPlayers[i]->GetLanguage(), Number, pText, VarArgs);
-			
-			Msg.m_pMessage = Buffer.buffer();
-			Server()->SendPackMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_NORECORD, i);
+			Server()->Localization()->Format_VLP(Buffer, pLanguage, Number, pText, VarArgs);
+		},
+		[&](const char *pMessage, const int *pClientIDs, int NumClients) {
+			SendChatPacked(pMessage, pClientIDs, NumClients);
 			Sent = true;
-		}
-	}
+		});
 
 	if(To < 0 && Sent)
 	{
-		Buffer.clear();
-		Buffer.append(GetChatCategoryPrefix(Category));
 		// one message for record
 		dynamic_string tmpBuf;
-		tmpBuf.copy(Buffer);
+		tmpBuf.append(GetChatCategoryPrefix(Category));
 		Server()->Localization()->Format_VLP(tmpBuf, "en", Number, pText, VarArgs);
 		Msg.m_pMessage = tmpBuf.buffer();
 		Server()->SendPackMsg(&Msg, MSGFLAG_VITAL | MSGFLAG_NOSEND, -1);
@@ -764,9 +818,6 @@ const char *CGameContext::GetChatCategoryPrefix(int Category)
 
 void CGameContext::SendBroadcast_Localization(int To, int Priority, int LifeSpan, const char* pText, ...)
 {
-	int Start = (To < 0 ? 0 : To);
-	int End = (To < 0 ? MAX_CLIENTS : To+1);
-	
 	dynamic_string Buffer;
 	
 	va_list VarArgs;
@@ -781,37 +832,31 @@ void CGameContext::SendBroadcast_Localization(int To, int Priority, int LifeSpan
 		Server()->SendPackMsg(&Msg, MSGFLAG_VITAL|MSGFLAG_NOSEND, -1);
 	}
 
-	for(int i = Start; i < End; i++)
-	{
-		if(m_apPlayers[i])
-		{
-			Buffer.clear();
-			Server()->Localization()->Format_VL(Buffer, m_apPlayers[i]->GetLanguage(), pText, VarArgs);
-			AddBroadcast(i, Buffer.buffer(), Priority, LifeSpan);
-		}
-	}
+	SendLocalized(To,
+		[&](dynamic_string &Buffer, const char *pLanguage) {
+			Server()->Localization()->Format_VL(Buffer, pLanguage, pText, VarArgs);
+		},
+		[&](const char *pMessage, const int *pClientIDs, int NumClients) {
+			for(int i = 0; i < NumClients; i++)
+				AddBroadcast(pClientIDs[i], pMessage, Priority, LifeSpan);
+		});
 	
 	va_end(VarArgs);
 }
 
 void CGameContext::SendBroadcast_Localization_P(int To, int Priority, int LifeSpan, int Number, const char* pText, ...)
 {
-	int Start = (To < 0 ? 0 : To);
-	int End = (To < 0 ? MAX_CLIENTS : To+1);
-	
-	dynamic_string Buffer;
-	
 	va_list VarArgs;
 	va_start(VarArgs, pText);
 	
-	for(int i = Start; i < End; i++)
-	{
-		if(m_apPlayers[i])
-		{
-			Server()->Localization()->Format_VLP(Buffer, m_apPlayers[i]->GetLanguage(), Number, pText, VarArgs);
-			AddBroadcast(i, Buffer.buffer(), Priority, LifeSpan);
-		}
-	}
+	SendLocalized(To,
+		[&](dynamic_string &Buffer, const char *pLanguage) {
+			Server()->Localization()->Format_VLP(Buffer, pLanguage, Number, pText, VarArgs);
+		},
+		[&](const char *pMessage, const int *pClientIDs, int NumClients) {
+			for(int i = 0; i < NumClients; i++)
+				AddBroadcast(pClientIDs[i], pMessage, Priority, LifeSpan);
+		});
 	
 	va_end(VarArgs);
 }
@@ -1257,17 +1302,24 @@ void CGameContext::OnTick()
 	CheckPureTuning();
 	
 	m_Collision.SetTime(m_pController->GetTime());
+	m_Collision.ResetConnectivityCache(Config()->m_InfConnectivityCache);
 
+	CProfiler *pProfiler = Server()->Profiler();
+	pProfiler->Begin(m_ProfileScopeController);
 	m_pController->TickBeforeWorld();
+	pProfiler->End(m_ProfileScopeController);
 
 	// copy tuning
 	m_World.m_Core.m_Tuning = m_Tuning;
 	m_World.Tick();
 
 	//if(world.paused) // make sure that the game object always updates
+	pProfiler->Begin(m_ProfileScopeController);
 	m_pController->Tick();
+	pProfiler->End(m_ProfileScopeController);
 
 	int NumActivePlayers = 0;
+	pProfiler->Begin(m_ProfileScopePlayers);
 	for(int i = 0; i < MAX_CLIENTS; i++)
 	{
 		if(m_apPlayers[i])
@@ -1305,6 +1357,7 @@ void CGameContext::OnTick()
 			}
 		}
 	}
+	pProfiler->End(m_ProfileScopePlayers);
 	
 	//Check for new broadcast
 	for(int i=0; i<MAX_CLIENTS; i++)
@@ -2844,6 +2897,38 @@ void CGameContext::ConTuneDump(IConsole::IResult *pResult, void *pUserData)
 	}
 }
 
+void CGameContext::ConDumpEntities(IConsole::IResult *pResult, void *pUserData)
+{
+	CGameContext *pSelf = (CGameContext *)pUserData;
+	char aBuf[256];
+	for(int Type = 0; Type < CGameWorld::NUM_ENTTYPES; Type++)
+	{
+		str_format(aBuf, sizeof(aBuf), "%s: live=%d max=%d", CGameWorld::EntityTypeName(Type), CEntity::NumLive(Type), CEntity::MaxLive(Type));
+		pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "entities", aBuf);
+	}
+
+	const CSlabAllocator &Allocator = CEntity::Allocator();
+	for(int Class = 0; Class < CSlabAllocator::NUM_SIZE_CLASSES; Class++)
+	{
+		const CSlabAllocator::CSizeClassStats &Stats = Allocator.Stats(Class);
+		if(!Stats.m_NumSlabs)
+			continue;
+		str_format(aBuf, sizeof(aBuf), "%d bytes: live=%d max=%d slabs=%d", (Class + 1) * CSlabAllocator::GRANULARITY, Stats.m_NumLive, Stats.m_MaxLive, Stats.m_NumSlabs);
+		pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "entities", aBuf);
+	}
+	str_format(aBuf, sizeof(aBuf), "%d slabs of %d bytes", Allocator.NumSlabs(), (int)CSlabAllocator::SLAB_SIZE);
+	pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "entities", aBuf);
+}
+
+void CGameContext::ConDumpLocalization(IConsole::IResult *pResult, void *pUserData)
+{
+	CGameContext *pSelf = (CGameContext *)pUserData;
+	char aBuf[256];
+	str_format(aBuf, sizeof(aBuf), "formatted %" PRId64 " texts for %" PRId64 " receivers, %" PRId64 " reused",
+		pSelf->m_LocalizedFormats, pSelf->m_LocalizedReceivers, pSelf->m_LocalizedReceivers - pSelf->m_LocalizedFormats);
+	pSelf->Console()->Print(IConsole::OUTPUT_LEVEL_STANDARD, "localization", aBuf);
+}
+
 void CGameContext::ConPause(IConsole::IResult *pResult, void *pUserData)
 {
 	CGameContext *pSelf = (CGameContext *)pUserData;
@@ -4551,6 +4636,8 @@ void CGameContext::OnConsoleInit()
 	Console()->Register("tune_reset", "", CFGFLAG_SERVER, ConTuneReset, this, "Reset tuning");
 	Console()->Register("tune_dump", "", CFGFLAG_SERVER, ConTuneDump, this, "Dump tuning");
 	Console()->Register("pause_game", "", CFGFLAG_SERVER, ConPause, this, "Pause/unpause game");
+	Console()->Register("dump_entities", "", CFGFLAG_SERVER, ConDumpEntities, this, "Dump the entity counts and allocator statistics");
+	Console()->Register("dump_localization", "", CFGFLAG_SERVER, ConDumpLocalization, this, "Dump how many localized texts were formatted and reused");
 	Console()->Register("change_map", "?r[map]", CFGFLAG_SERVER | CFGFLAG_STORE, ConChangeMap, this, "Change map");
 	Console()->Register("restart", "?i[seconds]", CFGFLAG_SERVER | CFGFLAG_STORE, ConRestart, this, "Restart in x seconds (0 = abort)");
 	Console()->Register("broadcast", "r[message]", CFGFLAG_SERVER, ConBroadcast, this, "Broadcast message");
@@ -4646,6 +4733,9 @@ void CGameContext::OnInit()
 	m_pEngine = nullptr;
 	m_pStorage = Kernel()->RequestInterface<IStorage>();
 	m_World.SetGameServer(this);
+	const int GameScope = Server()->Profiler()->AddScope("game");
+	m_ProfileScopeController = Server()->Profiler()->AddScope("controller", GameScope);
+	m_ProfileScopePlayers = Server()->Profiler()->AddScope("players", GameScope);
 	m_Events.SetGameServer(this);
 
 	m_GameUuid = RandomUuid();
@@ -4839,7 +4929,10 @@ void CGameContext::OnSnap(int ClientID)
 	}
 }
 
-void CGameContext::OnPreSnap() {}
+void CGameContext::OnPreSnap()
+{
+	m_World.PrepareSnap();
+}
 void CGameContext::OnPostSnap()
 {
 	m_Events.Clear();
@@ -93,11 +93,16 @@ class CGameContext : public IGameServer
 
 	bool m_Resetting;
 
+	int m_ProfileScopeController;
+	int m_ProfileScopePlayers;
+
 	static void ConTuneParam(IConsole::IResult *pResult, void *pUserData);
 	static void ConToggleTuneParam(IConsole::IResult *pResult, void *pUserData);
 	static void ConTuneReset(IConsole::IResult *pResult, void *pUserData);
 	static void ConTuneDump(IConsole::IResult *pResult, void *pUserData);
 	static void ConPause(IConsole::IResult *pResult, void *pUserData);
+	static void ConDumpEntities(IConsole::IResult *pResult, void *pUserData);
+	static void ConDumpLocalization(IConsole::IResult *pResult, void *pUserData);
 	static void ConChangeMap(IConsole::IResult *pResult, void *pUserData);
 	static void ConSkipMap(IConsole::IResult *pResult, void *pUserData);
 	static void ConQueueMap(IConsole::IResult *pResult, void *pUserData);
@@ -360,6 +365,16 @@ private:
 	static OPTION_VOTE_TYPE GetOptionVoteType(const char *pVoteCommand);
 	void GetMapNameFromCommand(char* pMapName, const char *pCommand);
 
+	// Formats a localized message once per language of its receivers (-1 for all)
+	// and passes the text with the receivers of that language to Send
+	template<typename FFormat, typename FSend>
+	void SendLocalized(int To, FFormat &&Format, FSend &&Send);
+	void SendChatPacked(const char *pText, const int *pClientIDs, int NumClients);
+
+	// texts formatted by SendLocalized() and the players they were sent to
+	int64_t m_LocalizedFormats = 0;
+	int64_t m_LocalizedReceivers = 0;
+
 public:
 	virtual void SendBroadcast(int To, const char *pText, int Priority, int LifeSpan);
 	virtual void SendBroadcast_Localization(int To, int Priority, int LifeSpan, const char* pText, ...);
@@ -349,6 +349,8 @@ void IGameController::EndRound()
 	GameServer()->m_World.m_Paused = true;
 	m_GameOverTick = Server()->Tick();
 	m_SuddenDeath = 0;
+
+	PrepareNextMap();
 }
 
 void IGameController::IncreaseCurrentRoundCounter()
@@ -844,6 +846,13 @@ void IGameController::CycleMap(bool Forced)
 }
 
 void IGameController::DefaultMapCycle()
+{
+	char aBuf[256] = {0};
+	if(GetDefaultCycleMap(aBuf))
+		RotateMapTo(aBuf);
+}
+
+bool IGameController::GetDefaultCycleMap(char *pMapName)
 {
 	int PlayerCount = Server()->GetActivePlayerCount();
 
@@ -851,9 +860,8 @@ void IGameController::DefaultMapCycle()
 	GetMapRotationInfo(&pMapRotationInfo);
 
 	if (pMapRotationInfo.m_MapCount == 0)
-		return;
+		return false;
 
-	char aBuf[256] = {0};
 	int i=0;
 	CMapInfo Info;
 	if (g_Config.m_InfMaprotationRandom)
@@ -863,8 +871,8 @@ void IGameController::DefaultMapCycle()
 		for ( ; i<32; i++)
 		{
 			RandInt = random_int(0, pMapRotationInfo.m_MapCount-1);
-			GetWordFromList(aBuf, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[RandInt]);
-			LoadMapConfig(aBuf, &Info);
+			GetWordFromList(pMapName, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[RandInt]);
+			LoadMapConfig(pMapName, &Info);
 
 			if(Info.MaximumPlayers && (PlayerCount > Info.MaximumPlayers))
 				continue;
@@ -891,8 +899,8 @@ void IGameController::DefaultMapCycle()
 				if (i == pMapRotationInfo.m_CurrentMapNumber)
 					break;
 			}
-			GetWordFromList(aBuf, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[i]);
-			LoadMapConfig(aBuf, &Info);
+			GetWordFromList(pMapName, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[i]);
+			LoadMapConfig(pMapName, &Info);
 
 			if(Info.MaximumPlayers && (PlayerCount > Info.MaximumPlayers))
 				continue;
@@ -910,17 +918,30 @@ void IGameController::DefaultMapCycle()
 		i++;
 		if (i >= pMapRotationInfo.m_MapCount)
 			i = 0;
-		GetWordFromList(aBuf, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[i]);
+		GetWordFromList(pMapName, g_Config.m_SvMaprotation, pMapRotationInfo.m_MapNameIndices[i]);
 	}
 
-	RotateMapTo(aBuf);
+	return true;
 }
 
 void IGameController::SmartMapCycle()
 {
-	if(s_aMapInfo.IsEmpty())
+	int BestMapIndex = GetSmartCycleMapIndex();
+	if(BestMapIndex < 0)
 		return;
 
+	const CMapInfoEx &Info = s_aMapInfo.At(BestMapIndex);
+	s_CachedMapIndex = BestMapIndex;
+
+	dbg_msg("smart-rotation", "rotating to index %d (name %s)", BestMapIndex, Info.Name());
+	RotateMapTo(Info.Name());
+}
+
+int IGameController::GetSmartCycleMapIndex()
+{
+	if(s_aMapInfo.IsEmpty())
+		return -1;
+
 	const char *pCurrentMap = g_Config.m_SvMap;
 	int CurrentActivePlayers = Server()->GetActivePlayerCount();
 
@@ -974,11 +995,46 @@ void IGameController::SmartMapCycle()
 		BestMapIndex = i;
 	}
 
-	const CMapInfoEx &Info = s_aMapInfo.At(BestMapIndex);
-	s_CachedMapIndex = BestMapIndex;
+	return BestMapIndex;
+}
 
-	dbg_msg("smart-rotation", "rotating to index %d (name %s)", BestMapIndex, Info.Name());
-	RotateMapTo(Info.Name());
+void IGameController::PrepareNextMap()
+{
+	// the map is already being changed
+	if(Server()->GetMapReload())
+		return;
+
+	// guess the map which CycleMap() is going to pick after the game over
+	char aMapName[256];
+	if(m_aMapWish[0] != 0)
+	{
+		str_copy(aMapName, m_aMapWish);
+	}
+	else if(m_RoundCount < g_Config.m_SvRoundsPerMap - 1 || !MapRotationEnabled())
+	{
+		return;
+	}
+	else if(m_aQueuedMap[0] != 0)
+	{
+		str_copy(aMapName, m_aQueuedMap);
+	}
+	else if(!str_length(g_Config.m_SvMaprotation))
+	{
+		return;
+	}
+	else if(Config()->m_InfSmartMapRotation)
+	{
+		int MapIndex = GetSmartCycleMapIndex();
+		if(MapIndex < 0)
+			return;
+		str_copy(aMapName, s_aMapInfo.At(MapIndex).Name());
+	}
+	else if(g_Config.m_InfMaprotationRandom || !GetDefaultCycleMap(aMapName))
+	{
+		return;
+	}
+
+	Server()->PrepareMap(aMapName);
 }
 
 void IGameController::SkipMap()
@@ -1136,6 +1192,10 @@ void IGameController::Tick()
 
 void IGameController::OnGameRestart()
 {
+	// wait until the server finished loading the next map
+	if(Server()->GetMapReload())
+		return;
+
 	CycleMap();
 	if(!Server()->GetMapReload())
 	{
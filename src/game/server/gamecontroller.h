@@ -62,7 +62,10 @@ protected:
 
 	void CycleMap(bool Forced = false);
 	void DefaultMapCycle();
+	bool GetDefaultCycleMap(char *pMapName);
 	void SmartMapCycle();
+	int GetSmartCycleMapIndex();
+	void PrepareNextMap();
 	void ResetGame();
 	void RotateMapTo(const char *pMapName);
 
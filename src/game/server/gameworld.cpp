@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 #include <engine/shared/config.h>
+#include <engine/shared/profiler.h>
 #include <game/server/player.h>
 
 //////////////////////////////////////////////////
@@ -22,7 +23,19 @@ CGameWorld::CGameWorld()
 	m_Paused = false;
 	m_ResetRequested = false;
 	for(int i = 0; i < NUM_ENTTYPES; i++)
+	{
 		m_apFirstEntityTypes[i] = 0;
+		m_aNumRemovedEntities[i] = 0;
+		m_aMaxProximityRadius[i] = 0.0f;
+		m_aTickProfileScopes[i] = -1;
+	}
+
+	for(bool &Valid : m_aSnapVisibleValid)
+		Valid = false;
+
+	m_GridWidth = 0;
+	m_GridHeight = 0;
+	m_TickProfileScope = -1;
 }
 
 CGameWorld::~CGameWorld()
@@ -38,6 +51,42 @@ void CGameWorld::SetGameServer(CGameContext *pGameServer)
 	m_pGameServer = pGameServer;
 	m_pConfig = pGameServer->Config();
 	m_pServer = m_pGameServer->Server();
+
+	CProfiler *pProfiler = m_pServer->Profiler();
+	m_TickProfileScope = pProfiler->AddScope("world", pProfiler->AddScope("game"));
+	for(int i = 0; i < NUM_ENTTYPES; i++)
+		m_aTickProfileScopes[i] = pProfiler->AddScope(EntityTypeName(i), m_TickProfileScope);
+}
+
+const char *CGameWorld::EntityTypeName(int Type)
+{
+	static const char *s_apNames[NUM_ENTTYPES] = {
+		"projectile",
+		"laser",
+		"pickup",
+		"growing_explosion",
+		"flying_point",
+		"character",
+		"engineer_wall",
+		"soldier_bomb",
+		"scientist_mine",
+		"scientist_laser",
+		"mercenary_bomb",
+		"scatter_grenade",
+		"medic_grenade",
+		"hero_flag",
+		"biologist_mine",
+		"slug_slime",
+		"bouncing_bullet",
+		"looper_wall",
+		"white_hole",
+		"superweapon_indicator",
+		"laser_teleport",
+		"turret",
+		"plasma",
+	};
+
+	return Type < 0 || Type >= NUM_ENTTYPES ? "unknown" : s_apNames[Type];
 }
 
 CEntity *CGameWorld::FindFirst(int Type)
@@ -45,23 +94,132 @@ CEntity *CGameWorld::FindFirst(int Type)
 	return Type < 0 || Type >= NUM_ENTTYPES ? 0 : m_apFirstEntityTypes[Type];
 }
 
-int CGameWorld::FindEntities(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type)
+void CGameWorld::InitGrid()
+{
+	// the collision is not loaded yet when the world is created
+	m_GridWidth = maximum(1, (GameServer()->Collision()->GetWidth() * 32 + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	m_GridHeight = maximum(1, (GameServer()->Collision()->GetHeight() * 32 + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE);
+	for(auto &vpCells : m_avpGridCells)
+		vpCells.assign(m_GridWidth * m_GridHeight, nullptr);
+}
+
+int CGameWorld::GridCellX(float x) const
 {
-	if(Type < 0 || Type >= NUM_ENTTYPES)
-		return 0;
+	return clamp(static_cast<int>(floorf(x / static_cast<float>(GRID_CELL_SIZE))), 0, m_GridWidth - 1);
+}
 
-	int Num = 0;
-	for(CEntity *pEnt = m_apFirstEntityTypes[Type]; pEnt; pEnt = pEnt->m_pNextTypeEntity)
+int CGameWorld::GridCellY(float y) const
+{
+	return clamp(static_cast<int>(floorf(y / static_cast<float>(GRID_CELL_SIZE))), 0, m_GridHeight - 1);
+}
+
+int CGameWorld::GridCell(vec2 Pos) const
+{
+	return GridCellY(Pos.y) * m_GridWidth + GridCellX(Pos.x);
+}
+
+void CGameWorld::GridInsert(CEntity *pEnt)
+{
+	if(!m_GridWidth)
+		InitGrid();
+
+	CEntity *&pFirst = m_avpGridCells[pEnt->m_ObjType][GridCell(pEnt->m_Pos)];
+	pEnt->m_GridCell = GridCell(pEnt->m_Pos);
+	pEnt->m_pPrevCellEntity = nullptr;
+	pEnt->m_pNextCellEntity = pFirst;
+	if(pFirst)
+		pFirst->m_pPrevCellEntity = pEnt;
+	pFirst = pEnt;
+
+	m_aMaxProximityRadius[pEnt->m_ObjType] = maximum(m_aMaxProximityRadius[pEnt->m_ObjType], pEnt->m_ProximityRadius);
+}
+
+void CGameWorld::GridRemove(CEntity *pEnt)
+{
+	if(pEnt->m_GridCell < 0)
+		return;
+
+	if(pEnt->m_pPrevCellEntity)
+		pEnt->m_pPrevCellEntity->m_pNextCellEntity = pEnt->m_pNextCellEntity;
+	else
+		m_avpGridCells[pEnt->m_ObjType][pEnt->m_GridCell] = pEnt->m_pNextCellEntity;
+	if(pEnt->m_pNextCellEntity)
+		pEnt->m_pNextCellEntity->m_pPrevCellEntity = pEnt->m_pPrevCellEntity;
+
+	pEnt->m_GridCell = -1;
+	pEnt->m_pPrevCellEntity = nullptr;
+	pEnt->m_pNextCellEntity = nullptr;
+}
+
+void CGameWorld::OnEntityMoved(CEntity *pEnt)
+{
+	if(GridCell(pEnt->m_Pos) == pEnt->m_GridCell)
+		return;
+
+	GridRemove(pEnt);
+	GridInsert(pEnt);
+}
+
+template<typename F>
+void CGameWorld::ForEachEntityInBox(int Type, vec2 BoxMin, vec2 BoxMax, F &&Callback)
+{
+	if(Type < 0 || Type >= NUM_ENTTYPES || !m_GridWidth)
+		return;
+
+	const float Margin = m_aMaxProximityRadius[Type];
+	const int MinX = GridCellX(BoxMin.x - Margin);
+	const int MinY = GridCellY(BoxMin.y - Margin);
+	const int MaxX = GridCellX(BoxMax.x + Margin);
+	const int MaxY = GridCellY(BoxMax.y + Margin);
+
+	CEntity **ppCells = m_avpGridCells[Type].data();
+	for(int y = MinY; y <= MaxY; y++)
 	{
+		for(int x = MinX; x <= MaxX; x++)
+		{
+			for(CEntity *pEnt = ppCells[y * m_GridWidth + x]; pEnt; pEnt = pEnt->m_pNextCellEntity)
+			{
+				if(!Callback(pEnt))
+					return;
+			}
+		}
+	}
+}
+
+int CGameWorld::FindCandidates(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type)
+{
+	int Num = 0;
+	ForEachEntityInBox(Type, Pos - vec2(Radius, Radius), Pos + vec2(Radius, Radius), [&](CEntity *pEnt) {
+		ppEnts[Num++] = pEnt;
+		return Num < Max;
+	});
+	return Num;
+}
+
+int CGameWorld::FindCandidatesOnSegment(vec2 Pos0, vec2 Pos1, float Radius, CEntity **ppEnts, int Max, int Type)
+{
+	int Num = 0;
+	const vec2 BoxMin(minimum(Pos0.x, Pos1.x) - Radius, minimum(Pos0.y, Pos1.y) - Radius);
+	const vec2 BoxMax(maximum(Pos0.x, Pos1.x) + Radius, maximum(Pos0.y, Pos1.y) + Radius);
+	ForEachEntityInBox(Type, BoxMin, BoxMax, [&](CEntity *pEnt) {
+		ppEnts[Num++] = pEnt;
+		return Num < Max;
+	});
+	return Num;
+}
+
+int CGameWorld::FindEntities(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type)
+{
+	int Num = 0;
+	ForEachEntityInBox(Type, Pos - vec2(Radius, Radius), Pos + vec2(Radius, Radius), [&](CEntity *pEnt) {
 		if(distance(pEnt->m_Pos, Pos) < Radius + pEnt->m_ProximityRadius)
 		{
 			if(ppEnts)
 				ppEnts[Num] = pEnt;
 			Num++;
-			if(Num == Max)
-				break;
 		}
-	}
+		return Num != Max;
+	});
 
 	return Num;
 }
@@ -72,11 +230,9 @@ CEntity *CGameWorld::ClosestEntity(vec2 Pos, float Radius, int Type, const CEnti
 	float ClosestRange = Radius * 2;
 	CEntity *pClosest = 0;
 
-	CEntity *p = FindFirst(Type);
-	for(; p; p = p->TypeNext())
- 	{
+	ForEachEntityInBox(Type, Pos - vec2(Radius, Radius), Pos + vec2(Radius, Radius), [&](CEntity *p) {
 		if(p == pNotThis)
-			continue;
+			return true;
 
 		float Len = distance(Pos, p->m_Pos);
 		if(Len < p->m_ProximityRadius + Radius)
@@ -87,7 +243,8 @@ CEntity *CGameWorld::ClosestEntity(vec2 Pos, float Radius, int Type, const CEnti
 				pClosest = p;
 			}
 		}
-	}
+		return true;
+	});
 
 	return pClosest;
 }
@@ -105,6 +262,15 @@ void CGameWorld::InsertEntity(CEntity *pEnt)
 	pEnt->m_pNextTypeEntity = m_apFirstEntityTypes[pEnt->m_ObjType];
 	pEnt->m_pPrevTypeEntity = 0x0;
 	m_apFirstEntityTypes[pEnt->m_ObjType] = pEnt;
+
+	pEnt->m_DenseIndex = m_avpEntities[pEnt->m_ObjType].size();
+	m_avpEntities[pEnt->m_ObjType].push_back(pEnt);
+
+	if(IsSnapClippedType(pEnt->m_ObjType))
+		InvalidateSnapVisibility();
+
+	GridRemove(pEnt);
+	GridInsert(pEnt);
 }
 
 void CGameWorld::DestroyEntity(CEntity *pEnt)
@@ -114,6 +280,8 @@ void CGameWorld::DestroyEntity(CEntity *pEnt)
 
 void CGameWorld::RemoveEntity(CEntity *pEnt)
 {
+	GridRemove(pEnt);
+
 	// not in the list
 	if(!pEnt->m_pNextTypeEntity && !pEnt->m_pPrevTypeEntity && m_apFirstEntityTypes[pEnt->m_ObjType] != pEnt)
 		return;
@@ -126,36 +294,164 @@ void CGameWorld::RemoveEntity(CEntity *pEnt)
 	if(pEnt->m_pNextTypeEntity)
 		pEnt->m_pNextTypeEntity->m_pPrevTypeEntity = pEnt->m_pPrevTypeEntity;
 
-	// keep list traversing valid
-	if(m_pNextTraverseEntity == pEnt)
-		m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
-
 	pEnt->m_pNextTypeEntity = 0;
 	pEnt->m_pPrevTypeEntity = 0;
+
+	// the snapshot visibility lists may point to this entity
+	if(IsSnapClippedType(pEnt->m_ObjType))
+		InvalidateSnapVisibility();
+
+	// keep the dense storage traversing valid, the slot is freed by CompactEntities()
+	m_avpEntities[pEnt->m_ObjType][pEnt->m_DenseIndex] = nullptr;
+	m_aNumRemovedEntities[pEnt->m_ObjType]++;
+	pEnt->m_DenseIndex = -1;
+}
+
+void CGameWorld::CompactEntities()
+{
+	for(int Type = 0; Type < NUM_ENTTYPES; Type++)
+	{
+		if(!m_aNumRemovedEntities[Type])
+			continue;
+
+		std::vector<CEntity *> &vpEntities = m_avpEntities[Type];
+		int NumEntities = 0;
+		for(CEntity *pEnt : vpEntities)
+		{
+			if(!pEnt)
+				continue;
+			pEnt->m_DenseIndex = NumEntities;
+			vpEntities[NumEntities++] = pEnt;
+		}
+		vpEntities.resize(NumEntities);
+		m_aNumRemovedEntities[Type] = 0;
+	}
+}
+
+// Visits the entities in the order of the type lists, newest first. The entities
+// inserted by the callback are not visited, the removed ones are skipped.
+template<typename F>
+void CGameWorld::ForEachEntity(F &&Callback)
+{
+	for(int Type = 0; Type < NUM_ENTTYPES; Type++)
+		ForEachEntityOfType(Type, Callback);
+}
+
+template<typename F>
+void CGameWorld::ForEachEntityOfType(int Type, F &&Callback)
+{
+	const std::vector<CEntity *> &vpEntities = m_avpEntities[Type];
+	for(int i = (int)vpEntities.size() - 1; i >= 0; i--)
+	{
+		CEntity *pEnt = vpEntities[i];
+		if(pEnt)
+			Callback(pEnt);
+	}
 }
 
 //
-void CGameWorld::Snap(int SnappingClient)
+bool CGameWorld::IsSnapClippedType(int Type)
 {
-	for(int i = 0; i < NUM_ENTTYPES; i++)
-		for(CEntity *pEnt = m_apFirstEntityTypes[i]; pEnt; )
+	// The Snap() of these entities returns without snapping anything when
+	// NetworkClipped(SnappingClient) is true for their m_Pos. They are culled
+	// through the grid, so a type only belongs here if it moves with SetPos().
+	switch(Type)
+	{
+	case ENTTYPE_PICKUP:
+	case ENTTYPE_SOLDIER_BOMB:
+	case ENTTYPE_SCIENTIST_MINE:
+	case ENTTYPE_MERCENARY_BOMB:
+	case ENTTYPE_HERO_FLAG:
+	case ENTTYPE_BIOLOGIST_MINE:
+	case ENTTYPE_SLUG_SLIME:
+	case ENTTYPE_WHITE_HOLE:
+	case ENTTYPE_SUPERWEAPON_INDICATOR:
+	case ENTTYPE_TURRET:
+	case ENTTYPE_PLASMA:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void CGameWorld::InvalidateSnapVisibility()
+{
+	for(bool &Valid : m_aSnapVisibleValid)
+		Valid = false;
+}
+
+void CGameWorld::PrepareSnap()
+{
+	for(int ClientID = 0; ClientID < MAX_CLIENTS; ClientID++)
+	{
+		const CPlayer *pPlayer = GameServer()->m_apPlayers[ClientID];
+		m_aSnapVisibleValid[ClientID] = pPlayer && !pPlayer->m_ShowAll && Server()->ClientIngame(ClientID);
+		if(!m_aSnapVisibleValid[ClientID])
+			continue;
+
+		// same test as NetworkClipped()
+		const vec2 ViewPos = pPlayer->m_ViewPos;
+		const vec2 ShowDistance = pPlayer->m_ShowDistance;
+		std::vector<CEntity *> &vpVisible = m_avpSnapVisible[ClientID];
+		vpVisible.clear();
+		for(int Type = 0; Type < NUM_ENTTYPES; Type++)
 		{
-			m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
+			const int Start = vpVisible.size();
+			m_aaSnapVisibleStart[ClientID][Type] = Start;
+			if(!IsSnapClippedType(Type))
+				continue;
+
+			ForEachEntityInBox(Type, ViewPos - ShowDistance, ViewPos + ShowDistance, [&](CEntity *pEnt) {
+				if(absolute(ViewPos.x - pEnt->m_Pos.x) <= ShowDistance.x && absolute(ViewPos.y - pEnt->m_Pos.y) <= ShowDistance.y)
+					vpVisible.push_back(pEnt);
+				return true;
+			});
+
+			// keep the snap order of the full traversal
+			std::sort(vpVisible.begin() + Start, vpVisible.end(), [](const CEntity *pA, const CEntity *pB) {
+				return pA->m_DenseIndex > pB->m_DenseIndex;
+			});
+		}
+		m_aaSnapVisibleStart[ClientID][NUM_ENTTYPES] = vpVisible.size();
+	}
+}
+
+void CGameWorld::Snap(int SnappingClient)
+{
+	if(SnappingClient < 0 || !m_aSnapVisibleValid[SnappingClient])
+	{
+		ForEachEntity([SnappingClient](CEntity *pEnt) {
 			pEnt->Snap(SnappingClient);
-			pEnt = m_pNextTraverseEntity;
+		});
+		return;
+	}
+
+	const std::vector<CEntity *> &vpVisible = m_avpSnapVisible[SnappingClient];
+	const int *pStart = m_aaSnapVisibleStart[SnappingClient];
+	for(int Type = 0; Type < NUM_ENTTYPES; Type++)
+	{
+		if(IsSnapClippedType(Type))
+		{
+			for(int i = pStart[Type]; i < pStart[Type + 1]; i++)
+				vpVisible[i]->Snap(SnappingClient);
+			continue;
+		}
+
+		std::vector<CEntity *> &vpEntities = m_avpEntities[Type];
+		for(int i = (int)vpEntities.size() - 1; i >= 0; i--)
+		{
+			if(vpEntities[i])
+				vpEntities[i]->Snap(SnappingClient);
 		}
+	}
 }
 
 void CGameWorld::Reset()
 {
 	// reset all entities
-	for(auto *pEnt : m_apFirstEntityTypes)
-		for(; pEnt;)
-		{
-			m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
-			pEnt->Reset();
-			pEnt = m_pNextTraverseEntity;
-		}
+	ForEachEntity([](CEntity *pEnt) {
+		pEnt->Reset();
+	});
 	RemoveEntities();
 
 	GameServer()->m_pController->OnReset();
@@ -167,17 +463,15 @@ void CGameWorld::Reset()
 void CGameWorld::RemoveEntities()
 {
 	// destroy objects marked for destruction
-	for(auto *pEnt : m_apFirstEntityTypes)
-		for(; pEnt;)
+	ForEachEntity([this](CEntity *pEnt) {
+		if(pEnt->m_MarkedForDestroy)
 		{
-			m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
-			if(pEnt->m_MarkedForDestroy)
-			{
-				RemoveEntity(pEnt);
-				pEnt->Destroy();
-			}
-			pEnt = m_pNextTraverseEntity;
+			RemoveEntity(pEnt);
+			pEnt->Destroy();
 		}
+	});
+
+	CompactEntities();
 }
 
 bool distCompare(std::pair<float,int> a, std::pair<float,int> b)
@@ -252,6 +546,11 @@ void CGameWorld::UpdatePlayerMaps()
 
 void CGameWorld::Tick()
 {
+	CProfileScope TickScope(Server()->Profiler(), m_TickProfileScope);
+
+	// the entities are going to move
+	InvalidateSnapVisibility();
+
 	if(m_ResetRequested)
 		Reset();
 
@@ -259,37 +558,41 @@ void CGameWorld::Tick()
 	{
 		if(GameServer()->m_pController->IsForceBalanced())
 			GameServer()->SendChat(-1, CGameContext::CHAT_ALL, "Teams have been balanced");
-		// update all objects
-		for(int i = 0; i < NUM_ENTTYPES; i++)
-			for(CEntity *pEnt = m_apFirstEntityTypes[i]; pEnt; )
-			{
-				m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
+		// update all objects, timed per entity type
+		CProfiler *pProfiler = Server()->Profiler();
+		for(int Type = 0; Type < NUM_ENTTYPES; Type++)
+		{
+			CProfileScope Scope(pProfiler, m_aTickProfileScopes[Type]);
+			ForEachEntityOfType(Type, [](CEntity *pEnt) {
 				pEnt->Tick();
-				pEnt = m_pNextTraverseEntity;
-			}
+			});
+		}
 
-		for(int i = 0; i < NUM_ENTTYPES; i++)
-			for(CEntity *pEnt = m_apFirstEntityTypes[i]; pEnt; )
-			{
-				m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
+		for(int Type = 0; Type < NUM_ENTTYPES; Type++)
+		{
+			CProfileScope Scope(pProfiler, m_aTickProfileScopes[Type]);
+			ForEachEntityOfType(Type, [](CEntity *pEnt) {
 				pEnt->TickDeferred();
-				pEnt = m_pNextTraverseEntity;
-			}
+			});
+		}
 	}
 	else
 	{
 		// update all objects
-		for(auto *pEnt : m_apFirstEntityTypes)
-			for(; pEnt;)
-			{
-				m_pNextTraverseEntity = pEnt->m_pNextTypeEntity;
-				pEnt->TickPaused();
-				pEnt = m_pNextTraverseEntity;
-			}
+		ForEachEntity([](CEntity *pEnt) {
+			pEnt->TickPaused();
+		});
 	}
 
 	RemoveEntities();
 
+#ifdef CONF_DEBUG
+	// an entity that changes m_Pos without SetPos() is missed by the grid queries
+	ForEachEntity([this](CEntity *pEnt) {
+		dbg_assert(pEnt->m_GridCell == GridCell(pEnt->m_Pos), "entity moved without SetPos()");
+	});
+#endif
+
 	UpdatePlayerMaps();
 }
 
@@ -298,15 +601,15 @@ CEntity *CGameWorld::IntersectEntity(vec2 Pos0, vec2 Pos1, float Radius, vec2 *N
 	float ClosestLen = distance(Pos0, Pos1) * 100.0f;
 
 	CEntity *pClosest = nullptr;
-	CEntity *p = FindFirst(EntityType);
-	for(; p; p = p->TypeNext())
-	{
+	const vec2 BoxMin(minimum(Pos0.x, Pos1.x) - Radius, minimum(Pos0.y, Pos1.y) - Radius);
+	const vec2 BoxMax(maximum(Pos0.x, Pos1.x) + Radius, maximum(Pos0.y, Pos1.y) + Radius);
+	ForEachEntityInBox(EntityType, BoxMin, BoxMax, [&](CEntity *p) {
 		if(FilterFunction && !FilterFunction(p))
-			continue;
+			return true;
 
 		vec2 IntersectPos;
 		if(!closest_point_on_line(Pos0, Pos1, p->m_Pos, IntersectPos))
-			continue;
+			return true;
 
 		float Len = distance(p->m_Pos, IntersectPos);
 		if(Len < p->m_ProximityRadius+Radius)
@@ -322,7 +625,8 @@ CEntity *CGameWorld::IntersectEntity(vec2 Pos0, vec2 Pos1, float Radius, vec2 *N
 				pClosest = p;
 			}
 		}
-	}
+		return true;
+	});
 
 	return pClosest;
 }
@@ -334,21 +638,22 @@ CCharacter *CGameWorld::IntersectCharacter(vec2 Pos0, vec2 Pos1, float Radius, v
 	float ClosestLen = distance(Pos0, Pos1) * 100.0f;
 	CCharacter *pClosest = 0;
 
-	CCharacter *p = (CCharacter *)FindFirst(ENTTYPE_CHARACTER);
-	for(; p; p = (CCharacter *)p->TypeNext())
- 	{
+	const vec2 BoxMin(minimum(Pos0.x, Pos1.x) - Radius, minimum(Pos0.y, Pos1.y) - Radius);
+	const vec2 BoxMax(maximum(Pos0.x, Pos1.x) + Radius, maximum(Pos0.y, Pos1.y) + Radius);
+	ForEachEntityInBox(ENTTYPE_CHARACTER, BoxMin, BoxMax, [&](CEntity *pEnt) {
+		CCharacter *p = static_cast<CCharacter *>(pEnt);
 		if(FilterFunction && !FilterFunction(p))
-			continue;
+			return true;
 
 		if(InfectedOnly && !p->Core()->m_Infected)
-			continue;
+			return true;
 
 		if(CollideWith != -1 && !p->CanCollide(CollideWith))
-			continue;
+			return true;
 
 		vec2 IntersectPos;
 		if(!closest_point_on_line(Pos0, Pos1, p->m_Pos, IntersectPos))
-			continue;
+			return true;
 
 		float Len = distance(p->m_Pos, IntersectPos);
 		if(Len < p->m_ProximityRadius+Radius)
@@ -361,37 +666,15 @@ CCharacter *CGameWorld::IntersectCharacter(vec2 Pos0, vec2 Pos1, float Radius, v
 				pClosest = p;
 			}
 		}
-	}
+		return true;
+	});
 
 	return pClosest;
 }
 
 CEntity *CGameWorld::IntersectEntity(vec2 Pos0, vec2 Pos1, float Radius, vec2 *NewPos, int EntityType)
 {
-	float ClosestLen = distance(Pos0, Pos1) * 100.0f;
-
-	CEntity *pClosest = nullptr;
-	CEntity *p = FindFirst(EntityType);
-	for(; p; p = (CEntity *)p->TypeNext())
-	{
-		vec2 IntersectPos;
-		if(!closest_point_on_line(Pos0, Pos1, p->m_Pos, IntersectPos))
-			continue;
-
-		float Len = distance(p->m_Pos, IntersectPos);
-		if(Len < p->m_ProximityRadius+Radius)
-		{
-			Len = distance(Pos0, IntersectPos);
-			if(Len < ClosestLen)
-			{
-				*NewPos = IntersectPos;
-				ClosestLen = Len;
-				pClosest = p;
-			}
-		}
-	}
-
-	return pClosest;
+	return IntersectEntity(Pos0, Pos1, Radius, NewPos, EntityType, nullptr);
 }
 
 CEntity *CGameWorld::GetClosestEntity(const vec2 From, CEntity *pEntity1, CEntity *pEntity2)
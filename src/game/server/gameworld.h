@@ -5,6 +5,8 @@
 
 #include <game/gamecore.h>
 
+#include <vector>
+
 class CEntity;
 class CCharacter;
 
@@ -46,13 +48,59 @@ public:
 		NUM_ENTTYPES
 	};
 
+	enum
+	{
+		GRID_CELL_SIZE = 4 * 32,
+	};
+
 private:
 	void Reset();
 	void RemoveEntities();
 
-	CEntity *m_pNextTraverseEntity;
 	CEntity *m_apFirstEntityTypes[NUM_ENTTYPES];
 
+	// Dense per type storage used by the tick and snap loops, oldest entities first.
+	// Removed entities leave a null slot until the next CompactEntities().
+	std::vector<CEntity *> m_avpEntities[NUM_ENTTYPES];
+	int m_aNumRemovedEntities[NUM_ENTTYPES];
+
+	void CompactEntities();
+
+	// Snapshot pre-culling: for every client, the visible entities of the types
+	// which are only snapped around their position. Filled by PrepareSnap(),
+	// sorted by type and in the ForEachEntity() order, with the start of each type.
+	std::vector<CEntity *> m_avpSnapVisible[MAX_CLIENTS];
+	int m_aaSnapVisibleStart[MAX_CLIENTS][NUM_ENTTYPES + 1];
+	bool m_aSnapVisibleValid[MAX_CLIENTS];
+
+	static bool IsSnapClippedType(int Type);
+	void InvalidateSnapVisibility();
+
+	template<typename F>
+	void ForEachEntity(F &&Callback);
+	template<typename F>
+	void ForEachEntityOfType(int Type, F &&Callback);
+
+	int m_TickProfileScope;
+	int m_aTickProfileScopes[NUM_ENTTYPES];
+
+	// Spatial index: per type, a list of entities for every GRID_CELL_SIZE cell of the map.
+	// Entities outside of the map are kept in the border cells.
+	int m_GridWidth;
+	int m_GridHeight;
+	std::vector<CEntity *> m_avpGridCells[NUM_ENTTYPES];
+	float m_aMaxProximityRadius[NUM_ENTTYPES];
+
+	void InitGrid();
+	int GridCellX(float x) const;
+	int GridCellY(float y) const;
+	int GridCell(vec2 Pos) const;
+	void GridInsert(CEntity *pEnt);
+	void GridRemove(CEntity *pEnt);
+
+	template<typename F>
+	void ForEachEntityInBox(int Type, vec2 BoxMin, vec2 BoxMax, F &&Callback);
+
 	class CGameContext *m_pGameServer;
 	class CConfig *m_pConfig;
 	class IServer *m_pServer;
@@ -73,6 +121,15 @@ public:
 
 	void SetGameServer(CGameContext *pGameServer);
 
+	/*
+		Function: PrepareSnap
+			Computes the entities visible by each client, once per
+			snapshot, so that Snap() only visits the relevant ones.
+	*/
+	void PrepareSnap();
+
+	static const char *EntityTypeName(int Type);
+
 	CEntity *FindFirst(int Type);
 
 	template<typename T>
@@ -98,6 +155,38 @@ public:
 			Number of entities found and added to the ents array.
 	*/
 	int FindEntities(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type);
+
+	/*
+		Function: FindCandidates
+			Returns the entities which are in the spatial index cells
+			touched by a circle. The candidates still need an exact test.
+
+		Arguments:
+			pos - Position.
+			radius - Radius of the circle (the entity proximity radius is
+				already accounted for).
+			ents - Pointer to a list that should be filled with the pointers
+				to the entities.
+			max - Number of entities that fits into the ents array.
+			type - Type of the entities to find.
+
+		Returns:
+			Number of entities added to the ents array.
+	*/
+	int FindCandidates(vec2 Pos, float Radius, CEntity **ppEnts, int Max, int Type);
+
+	/*
+		Function: FindCandidatesOnSegment
+			Same as FindCandidates, for the cells swept by a segment
+			of the given radius.
+	*/
+	int FindCandidatesOnSegment(vec2 Pos0, vec2 Pos1, float Radius, CEntity **ppEnts, int Max, int Type);
+
+	/*
+		Function: OnEntityMoved
+			Keeps the spatial index up to date. Called by CEntity::SetPos().
+	*/
+	void OnEntityMoved(CEntity *pEntity);
 	
 	/*
 		Function: closest_CEntity
@@ -296,15 +296,9 @@ void CInfClassHuman::OnPlayerSnap(int SnappingClient, int InfClassVersion)
 			}
 			break;
 		case EPlayerClass::Engineer:
-			for(TEntityPtr<CEngineerWall> pWall = GameWorld()->FindFirst<CEngineerWall>(); pWall; ++pWall)
+			if(CEngineerWall *pWall = CInfCEntity::FindFirstOwned<CEngineerWall>(GetCID()))
 			{
-				if(pWall->GetOwner() != GetCID())
-				{
-					continue;
-				}
-
 				pClassInfo->m_Data1 = pWall->GetEndTick();
-				break;
 			}
 			break;
 		case EPlayerClass::Scientist:
@@ -314,15 +308,9 @@ void CInfClassHuman::OnPlayerSnap(int SnappingClient, int InfClassVersion)
 			}
 			break;
 		case EPlayerClass::Looper:
-			for(TEntityPtr<CLooperWall> pWall = GameWorld()->FindFirst<CLooperWall>(); pWall; ++pWall)
+			if(CLooperWall *pWall = CInfCEntity::FindFirstOwned<CLooperWall>(GetCID()))
 			{
-				if(pWall->GetOwner() != GetCID())
-				{
-					continue;
-				}
-
 				pClassInfo->m_Data1 = pWall->GetEndTick();
-				break;
 			}
 			break;
 		default:
@@ -1210,15 +1198,7 @@ void CInfClassHuman::BroadcastWeaponState() const
 		if(ClientVersion >= VERSION_INFC_160)
 			return;
 
-		CEngineerWall *pCurrentWall = NULL;
-		for(CEngineerWall *pWall = (CEngineerWall*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_ENGINEER_WALL); pWall; pWall = (CEngineerWall*) pWall->TypeNext())
-		{
-			if(pWall->GetOwner() == m_pPlayer->GetCID())
-			{
-				pCurrentWall = pWall;
-				break;
-			}
-		}
+		CEngineerWall *pCurrentWall = CInfCEntity::FindFirstOwned<CEngineerWall>(GetCID());
 
 		if(pCurrentWall && pCurrentWall->HasSecondPosition())
 		{
@@ -1265,15 +1245,7 @@ void CInfClassHuman::BroadcastWeaponState() const
 			return;
 
 		//Potential variable name conflict with engineerwall with pCurrentWall
-		CLooperWall* pCurrentWall = NULL;
-		for(CLooperWall *pWall = (CLooperWall*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_LOOPER_WALL); pWall; pWall = (CLooperWall*) pWall->TypeNext())
-		{
-			if(pWall->GetOwner() == m_pPlayer->GetCID())
-			{
-				pCurrentWall = pWall;
-				break;
-			}
-		}
+		CLooperWall *pCurrentWall = CInfCEntity::FindFirstOwned<CLooperWall>(GetCID());
 
 		if(pCurrentWall && pCurrentWall->HasSecondPosition())
 		{
@@ -1290,11 +1262,9 @@ void CInfClassHuman::BroadcastWeaponState() const
 	else if(GetPlayerClass() == EPlayerClass::Soldier)
 	{
 		int NumBombs = 0;
-		for(CSoldierBomb *pBomb = (CSoldierBomb*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_SOLDIER_BOMB); pBomb; pBomb = (CSoldierBomb*) pBomb->TypeNext())
-		{
-			if(pBomb->GetOwner() == m_pPlayer->GetCID())
-				NumBombs += pBomb->GetNbBombs();
-		}
+		CInfCEntity::ForEachOwnedEntity<CSoldierBomb>(GetCID(), [&](CSoldierBomb *pBomb) {
+			NumBombs += pBomb->GetNbBombs();
+		});
 
 		if(NumBombs)
 		{
@@ -1310,21 +1280,11 @@ void CInfClassHuman::BroadcastWeaponState() const
 	else if(GetPlayerClass() == EPlayerClass::Scientist)
 	{
 		int NumMines = 0;
-		for(CScientistMine *pMine = (CScientistMine*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_SCIENTIST_MINE); pMine; pMine = (CScientistMine*) pMine->TypeNext())
-		{
-			if(pMine->GetOwner() == m_pPlayer->GetCID())
-				NumMines++;
-		}
+		CInfCEntity::ForEachOwnedEntity<CScientistMine>(GetCID(), [&](CScientistMine *pMine) {
+			NumMines++;
+		});
 
-		CWhiteHole* pCurrentWhiteHole = NULL;
-		for(CWhiteHole *pWhiteHole = (CWhiteHole*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_WHITE_HOLE); pWhiteHole; pWhiteHole = (CWhiteHole*) pWhiteHole->TypeNext())
-		{
-			if(pWhiteHole->GetOwner() == m_pPlayer->GetCID())
-			{
-				pCurrentWhiteHole = pWhiteHole;
-				break;
-			}
-		}
+		CWhiteHole *pCurrentWhiteHole = CInfCEntity::FindFirstOwned<CWhiteHole>(GetCID());
 
 		if(m_BroadcastWhiteHoleReady + (2 * Server()->TickSpeed()) > Server()->Tick())
 		{
@@ -1375,11 +1335,9 @@ void CInfClassHuman::BroadcastWeaponState() const
 	else if(GetPlayerClass() == EPlayerClass::Biologist)
 	{
 		int NumMines = 0;
-		for(CBiologistMine *pMine = (CBiologistMine*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_BIOLOGIST_MINE); pMine; pMine = (CBiologistMine*) pMine->TypeNext())
-		{
-			if(pMine->GetOwner() == m_pPlayer->GetCID())
-				NumMines++;
-		}
+		CInfCEntity::ForEachOwnedEntity<CBiologistMine>(GetCID(), [&](CBiologistMine *pMine) {
+			NumMines++;
+		});
 
 		if(NumMines > 0)
 		{
@@ -1432,15 +1390,7 @@ void CInfClassHuman::BroadcastWeaponState() const
 	}
 	else if(GetPlayerClass() == EPlayerClass::Mercenary)
 	{
-		CMercenaryBomb *pCurrentBomb = nullptr;
-		for(CMercenaryBomb *pBomb = (CMercenaryBomb*) GameWorld()->FindFirst(CGameWorld::ENTTYPE_MERCENARY_BOMB); pBomb; pBomb = (CMercenaryBomb*) pBomb->TypeNext())
-		{
-			if(pBomb->GetOwner() == m_pPlayer->GetCID())
-			{
-				pCurrentBomb = pBomb;
-				break;
-			}
-		}
+		CMercenaryBomb *pCurrentBomb = CInfCEntity::FindFirstOwned<CMercenaryBomb>(GetCID());
 
 		if(pCurrentBomb)
 		{
@@ -1706,19 +1656,15 @@ void CInfClassHuman::ActivateNinja(WeaponFireContext *pFireContext)
 void CInfClassHuman::PlaceEngineerWall(WeaponFireContext *pFireContext)
 {
 	TEntityPtr<CEngineerWall> pExistingWall;
-	for(TEntityPtr<CEngineerWall> pWall = GameWorld()->FindFirst<CEngineerWall>(); pWall; ++pWall)
+	if(CEngineerWall *pWall = CInfCEntity::FindFirstOwned<CEngineerWall>(GetCID()))
 	{
-		if(pWall->GetOwner() == GetCID())
+		if(pWall->HasSecondPosition())
 		{
-			if(pWall->HasSecondPosition())
-			{
-				GameWorld()->DestroyEntity(pWall);
-			}
-			else
-			{
-				pExistingWall = pWall;
-			}
-			break;
+			GameWorld()->DestroyEntity(pWall);
+		}
+		else
+		{
+			pExistingWall = pWall;
 		}
 	}
 
@@ -1751,19 +1697,15 @@ void CInfClassHuman::PlaceEngineerWall(WeaponFireContext *pFireContext)
 void CInfClassHuman::PlaceLooperWall(WeaponFireContext *pFireContext)
 {
 	TEntityPtr<CLooperWall> pExistingWall;
-	for(TEntityPtr<CLooperWall> pWall = GameWorld()->FindFirst<CLooperWall>(); pWall; ++pWall)
+	if(CLooperWall *pWall = CInfCEntity::FindFirstOwned<CLooperWall>(GetCID()))
 	{
-		if(pWall->GetOwner() == GetCID())
+		if(pWall->HasSecondPosition())
 		{
-			if(pWall->HasSecondPosition())
-			{
-				GameWorld()->DestroyEntity(pWall);
-			}
-			else
-			{
-				pExistingWall = pWall;
-			}
-			break;
+			GameWorld()->DestroyEntity(pWall);
+		}
+		else
+		{
+			pExistingWall = pWall;
 		}
 	}
 
@@ -1797,13 +1739,10 @@ void CInfClassHuman::FireSoldierBomb(WeaponFireContext *pFireContext)
 {
 	vec2 ProjStartPos = GetPos() + GetDirection() * GetProximityRadius() * 0.75f;
 
-	for(CSoldierBomb *pBomb = (CSoldierBomb *)GameWorld()->FindFirst(CGameWorld::ENTTYPE_SOLDIER_BOMB); pBomb; pBomb = (CSoldierBomb *)pBomb->TypeNext())
+	if(CSoldierBomb *pBomb = CInfCEntity::FindFirstOwned<CSoldierBomb>(GetCID()))
 	{
-		if(pBomb->GetOwner() == GetCID())
-		{
-			pBomb->Explode();
-			return;
-		}
+		pBomb->Explode();
+		return;
 	}
 
 	new CSoldierBomb(GameServer(), ProjStartPos, GetCID());
@@ -1812,15 +1751,7 @@ void CInfClassHuman::FireSoldierBomb(WeaponFireContext *pFireContext)
 
 void CInfClassHuman::FireMercenaryBomb(WeaponFireContext *pFireContext)
 {
-	CMercenaryBomb *pCurrentBomb = nullptr;
-	for(CMercenaryBomb *pBomb = (CMercenaryBomb *)GameWorld()->FindFirst(CGameWorld::ENTTYPE_MERCENARY_BOMB); pBomb; pBomb = (CMercenaryBomb *)pBomb->TypeNext())
-	{
-		if(pBomb->GetOwner() == GetCID())
-		{
-			pCurrentBomb = pBomb;
-			break;
-		}
-	}
+	CMercenaryBomb *pCurrentBomb = CInfCEntity::FindFirstOwned<CMercenaryBomb>(GetCID());
 
 	if(pCurrentBomb)
 	{
@@ -1936,13 +1867,10 @@ void CInfClassHuman::OnMercGrenadeFired(WeaponFireContext *pFireContext)
 	// Find bomb
 	bool BombFound = false;
 
-	for(TEntityPtr<CScatterGrenade> pGrenade = GameWorld()->FindFirst<CScatterGrenade>(); pGrenade; ++pGrenade)
-	{
-		if(pGrenade->GetOwner() != GetCID())
-			continue;
+	CInfCEntity::ForEachOwnedEntity<CScatterGrenade>(GetCID(), [&](CScatterGrenade *pGrenade) {
 		pGrenade->Explode();
 		BombFound = true;
-	}
+	});
 
 	if(BombFound)
 	{
@@ -2025,11 +1953,9 @@ void CInfClassHuman::OnBiologistLaserFired(WeaponFireContext *pFireContext)
 		return;
 	}
 
-	for(TEntityPtr<CBiologistMine> pMine = GameWorld()->FindFirst<CBiologistMine>(); pMine; ++pMine)
-	{
-		if(pMine->GetOwner() != GetCID()) continue;
-			GameWorld()->DestroyEntity(pMine);
-	}
+	CInfCEntity::ForEachOwnedEntity<CBiologistMine>(GetCID(), [&](CBiologistMine *pMine) {
+		GameWorld()->DestroyEntity(pMine);
+	});
 
 	int Lasers = Config()->m_InfBioMineLasers;
 	int PerLaserDamage = 10;
@@ -2039,15 +1965,7 @@ void CInfClassHuman::OnBiologistLaserFired(WeaponFireContext *pFireContext)
 
 void CInfClassHuman::OnMercLaserFired(WeaponFireContext *pFireContext)
 {
-	CMercenaryBomb *pCurrentBomb = nullptr;
-	for(TEntityPtr<CMercenaryBomb> pBomb = GameWorld()->FindFirst<CMercenaryBomb>(); pBomb; ++pBomb)
-	{
-		if(pBomb->GetOwner() == GetCID())
-		{
-			pCurrentBomb = pBomb;
-			break;
-		}
-	}
+	CMercenaryBomb *pCurrentBomb = CInfCEntity::FindFirstOwned<CMercenaryBomb>(GetCID());
 
 	if(!pCurrentBomb)
 	{
@@ -57,6 +57,9 @@ void CBiologistMine::Snap(int SnappingClient)
 			return;
 	}
 
+	if(!m_SnapCache.Begin(Server(), SnappingClient, LaserSnapVariant(SnappingClient)))
+		return;
+
 	float AngleStep = 2.0f * pi / m_Vertices;
 	float Radius = 32.0f;
 
@@ -70,6 +73,7 @@ void CBiologistMine::Snap(int SnappingClient)
 	}
 
 	GameServer()->SnapLaserObject(Context, m_IDs[m_Vertices], m_EndPos, m_Pos, Server()->Tick() - 4, GetOwner());
+	m_SnapCache.End(Server());
 }
 
 void CBiologistMine::Tick()
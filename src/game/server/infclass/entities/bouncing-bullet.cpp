@@ -87,7 +87,7 @@ void CBouncingBullet::Tick()
 		CollisionPos.y = NewPos.y;
 		int CollideX = GameServer()->Collision()->IntersectLineWeapon(PrevPos, CollisionPos, NULL, NULL);
 
-		m_Pos = NewPos;
+		SetPos(NewPos);
 		m_ActualPos = m_Pos;
 		vec2 vel;
 		vel.x = m_Direction.x;
@@ -131,6 +131,9 @@ void CEngineerWall::Snap(int SnappingClient)
 		}
 	}
 
+	if(!m_SnapCache.Begin(Server(), SnappingClient, LaserSnapVariant(SnappingClient)))
+		return;
+
 	int SnappingClientVersion = GameServer()->GetClientVersion(SnappingClient);
 	CSnapContext Context(SnappingClientVersion);
 
@@ -140,6 +143,7 @@ void CEngineerWall::Snap(int SnappingClient)
 	{
 		GameServer()->SnapLaserObject(Context, m_EndPointID, m_Pos2, m_Pos2, Server()->Tick(), m_Owner);
 	}
+	m_SnapCache.End(Server());
 }
 
 void CEngineerWall::OnHitInfected(CInfClassCharacter *pCharacter)
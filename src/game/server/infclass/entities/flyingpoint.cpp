@@ -32,7 +32,7 @@ void CFlyingPoint::Tick()
 		else
 		{
 			vec2 Dir = normalize(OwnerChar->GetPos() - m_Pos);
-			m_Pos += Dir*clamp(Dist, 0.0f, 16.0f) * (1.0f - m_InitialAmount) + m_InitialVel * m_InitialAmount;
+			SetPos(m_Pos + Dir*clamp(Dist, 0.0f, 16.0f) * (1.0f - m_InitialAmount) + m_InitialVel * m_InitialAmount);
 			
 			m_InitialAmount *= 0.98f;
 		}
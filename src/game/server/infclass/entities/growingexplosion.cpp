@@ -9,6 +9,8 @@
 #include <game/infclass/damage_type.h>
 #include <game/server/infclass/infcgamecontroller.h>
 
+#include <algorithm>
+
 #include "infccharacter.h"
 
 CGrowingExplosion::CGrowingExplosion(CGameContext *pGameContext, vec2 Pos, vec2 Dir, int Owner, int Radius, GROWING_EXPLOSION_EFFECT ExplosionEffect) :
@@ -99,6 +101,7 @@ CGrowingExplosion::CGrowingExplosion(CGameContext *pGameContext, vec2 Pos, vec2
 	}
 	
 	m_pGrowingMap[m_MaxGrowing*m_GrowingMap_Length+m_MaxGrowing] = Server()->Tick();
+	m_GrowingFrontier.push_back(m_MaxGrowing*m_GrowingMap_Length+m_MaxGrowing);
 	
 	switch(m_ExplosionEffect)
 	{
@@ -139,108 +142,9 @@ void CGrowingExplosion::Tick()
 		return;
 	}
 	
-	bool NewTile = false;
-	
-	for(int j=0; j<m_GrowingMap_Length; j++)
-	{
-		for(int i=0; i<m_GrowingMap_Length; i++)
-		{
-			if(m_pGrowingMap[j*m_GrowingMap_Length+i] == -1)
-			{
-				bool FromLeft = (i > 0 && m_pGrowingMap[j*m_GrowingMap_Length+i-1] < tick && m_pGrowingMap[j*m_GrowingMap_Length+i-1] >= 0);
-				bool FromRight = (i < m_GrowingMap_Length-1 && m_pGrowingMap[j*m_GrowingMap_Length+i+1] < tick && m_pGrowingMap[j*m_GrowingMap_Length+i+1] >= 0);
-				bool FromTop = (j > 0 && m_pGrowingMap[(j-1)*m_GrowingMap_Length+i] < tick && m_pGrowingMap[(j-1)*m_GrowingMap_Length+i] >= 0);
-				bool FromBottom = (j < m_GrowingMap_Length-1 && m_pGrowingMap[(j+1)*m_GrowingMap_Length+i] < tick && m_pGrowingMap[(j+1)*m_GrowingMap_Length+i] >= 0);
-				
-				if(FromLeft || FromRight || FromTop || FromBottom)
-				{
-					m_pGrowingMap[j*m_GrowingMap_Length+i] = tick;
-					NewTile = true;
-					m_VisualizedTiles++;
-					vec2 TileCenter = m_SeedPos + vec2(32.0f*(i-m_MaxGrowing) - 16.0f + random_float()*32.0f, 32.0f*(j-m_MaxGrowing) - 16.0f + random_float()*32.0f);
-					switch(m_ExplosionEffect)
-					{
-					case GROWING_EXPLOSION_EFFECT::FREEZE_INFECTED:
-						if(random_prob(0.1f))
-						{
-							GameServer()->CreateHammerHit(TileCenter);
-						}
-						break;
-					case GROWING_EXPLOSION_EFFECT::POISON_INFECTED:
-						if(random_prob(0.1f))
-						{
-							GameServer()->CreateDeath(TileCenter, m_Owner);
-						}
-						break;
-					case GROWING_EXPLOSION_EFFECT::HEAL_HUMANS:
-						if(m_VisualizedTiles % 8 == 0)
-						{
-							GameServer()->CreateDeath(TileCenter, m_Owner);
-						}
-						break;
-					case GROWING_EXPLOSION_EFFECT::LOVE_INFECTED:
-						if(random_prob(0.2f))
-						{
-							GameServer()->CreateLoveEvent(TileCenter);
-						}
-						break;
-					case GROWING_EXPLOSION_EFFECT::BOOM_INFECTED:
-						if(random_prob(0.2f))
-						{
-							float DamageFactor = m_DamageType == EDamageType::MERCENARY_BOMB ? 0 : 1;
-							GameController()->CreateExplosion(TileCenter, m_Owner, m_DamageType, DamageFactor);
-						}
-						break;
-					case GROWING_EXPLOSION_EFFECT::ELECTRIC_INFECTED:
-					{
-						vec2 EndPoint = m_SeedPos + vec2(32.0f*(i-m_MaxGrowing) - 16.0f + random_float()*32.0f, 32.0f*(j-m_MaxGrowing) - 16.0f + random_float()*32.0f);
-						m_pGrowingMapVec[j*m_GrowingMap_Length+i] = EndPoint;
-
-						int NumPossibleStartPoint = 0;
-						vec2 PossibleStartPoint[4];
-
-						if(FromLeft)
-						{
-							PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[j*m_GrowingMap_Length+i-1];
-							NumPossibleStartPoint++;
-						}
-						if(FromRight)
-						{
-							PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[j*m_GrowingMap_Length+i+1];
-							NumPossibleStartPoint++;
-						}
-						if(FromTop)
-						{
-							PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[(j-1)*m_GrowingMap_Length+i];
-							NumPossibleStartPoint++;
-						}
-						if(FromBottom)
-						{
-							PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[(j+1)*m_GrowingMap_Length+i];
-							NumPossibleStartPoint++;
-						}
-
-						if(NumPossibleStartPoint > 0)
-						{
-							int randNb = random_int(0, NumPossibleStartPoint-1);
-							vec2 StartPoint = PossibleStartPoint[randNb];
-							GameServer()->CreateLaserDotEvent(StartPoint, EndPoint, Server()->TickSpeed()/6);
-						}
-
-						if(random_prob(0.1f))
-						{
-							GameServer()->CreateSound(EndPoint, SOUND_LASER_BOUNCE);
-						}
-					}
-						break;
-					default:
-						break;
-					}
-				}
-			}
-		}
-	}
-	
+	GrowTiles(tick);
+	bool NewTile = !m_NewTiles.empty();
+
 	if(NewTile)
 	{
 		switch(m_ExplosionEffect)
@@ -256,9 +160,13 @@ void CGrowingExplosion::Tick()
 		}
 	}
 	
-	// Find other players
-	for(TEntityPtr<CInfClassCharacter> p = GameWorld()->FindFirst<CInfClassCharacter>(); p; ++p)
+	// Find other players, only the ones around the grown tiles can be hit
+	CInfClassCharacter *apCloseCharacters[MAX_CLIENTS];
+	const float HalfSize = (m_MaxGrowing + 1) * 32.0f;
+	int NumCloseCharacters = GameWorld()->FindCandidates(m_SeedPos, HalfSize, (CEntity **)apCloseCharacters, MAX_CLIENTS, CGameWorld::ENTTYPE_CHARACTER);
+	for(int c = 0; c < NumCloseCharacters; c++)
 	{
+		CInfClassCharacter *p = apCloseCharacters[c];
 		int tileX = m_MaxGrowing + static_cast<int>(round(p->m_Pos.x))/32 - m_SeedX;
 		int tileY = m_MaxGrowing + static_cast<int>(round(p->m_Pos.y))/32 - m_SeedY;
 		
@@ -376,6 +284,137 @@ void CGrowingExplosion::Tick()
 	}
 }
 
+void CGrowingExplosion::GrowTiles(int Tick)
+{
+	m_NewTiles.clear();
+
+	// Only the tiles grown before this tick spread, the others wait in the frontier
+	int NumPending = 0;
+	for(int Index : m_GrowingFrontier)
+	{
+		if(m_pGrowingMap[Index] >= Tick)
+		{
+			m_GrowingFrontier[NumPending++] = Index;
+			continue;
+		}
+
+		const int i = Index % m_GrowingMap_Length;
+		const int j = Index / m_GrowingMap_Length;
+		const int aNeighbours[4] = {
+			i > 0 ? Index - 1 : -1,
+			i < m_GrowingMap_Length - 1 ? Index + 1 : -1,
+			j > 0 ? Index - m_GrowingMap_Length : -1,
+			j < m_GrowingMap_Length - 1 ? Index + m_GrowingMap_Length : -1,
+		};
+
+		for(int Neighbour : aNeighbours)
+		{
+			if(Neighbour >= 0 && m_pGrowingMap[Neighbour] == -1)
+			{
+				m_pGrowingMap[Neighbour] = Tick;
+				m_NewTiles.push_back(Neighbour);
+			}
+		}
+	}
+	m_GrowingFrontier.resize(NumPending);
+
+	// Keep the row order of the full map scan for the effects
+	std::sort(m_NewTiles.begin(), m_NewTiles.end());
+
+	for(int Index : m_NewTiles)
+	{
+		m_GrowingFrontier.push_back(Index);
+
+		const int i = Index % m_GrowingMap_Length;
+		const int j = Index / m_GrowingMap_Length;
+		bool FromLeft = (i > 0 && m_pGrowingMap[j*m_GrowingMap_Length+i-1] < Tick && m_pGrowingMap[j*m_GrowingMap_Length+i-1] >= 0);
+		bool FromRight = (i < m_GrowingMap_Length-1 && m_pGrowingMap[j*m_GrowingMap_Length+i+1] < Tick && m_pGrowingMap[j*m_GrowingMap_Length+i+1] >= 0);
+		bool FromTop = (j > 0 && m_pGrowingMap[(j-1)*m_GrowingMap_Length+i] < Tick && m_pGrowingMap[(j-1)*m_GrowingMap_Length+i] >= 0);
+		bool FromBottom = (j < m_GrowingMap_Length-1 && m_pGrowingMap[(j+1)*m_GrowingMap_Length+i] < Tick && m_pGrowingMap[(j+1)*m_GrowingMap_Length+i] >= 0);
+
+		m_VisualizedTiles++;
+		vec2 TileCenter = m_SeedPos + vec2(32.0f*(i-m_MaxGrowing) - 16.0f + random_float()*32.0f, 32.0f*(j-m_MaxGrowing) - 16.0f + random_float()*32.0f);
+		switch(m_ExplosionEffect)
+		{
+		case GROWING_EXPLOSION_EFFECT::FREEZE_INFECTED:
+			if(random_prob(0.1f))
+			{
+				GameServer()->CreateHammerHit(TileCenter);
+			}
+			break;
+		case GROWING_EXPLOSION_EFFECT::POISON_INFECTED:
+			if(random_prob(0.1f))
+			{
+				GameServer()->CreateDeath(TileCenter, m_Owner);
+			}
+			break;
+		case GROWING_EXPLOSION_EFFECT::HEAL_HUMANS:
+			if(m_VisualizedTiles % 8 == 0)
+			{
+				GameServer()->CreateDeath(TileCenter, m_Owner);
+			}
+			break;
+		case GROWING_EXPLOSION_EFFECT::LOVE_INFECTED:
+			if(random_prob(0.2f))
+			{
+				GameServer()->CreateLoveEvent(TileCenter);
+			}
+			break;
+		case GROWING_EXPLOSION_EFFECT::BOOM_INFECTED:
+			if(random_prob(0.2f))
+			{
+				float DamageFactor = m_DamageType == EDamageType::MERCENARY_BOMB ? 0 : 1;
+				GameController()->CreateExplosion(TileCenter, m_Owner, m_DamageType, DamageFactor);
+			}
+			break;
+		case GROWING_EXPLOSION_EFFECT::ELECTRIC_INFECTED:
+		{
+			vec2 EndPoint = m_SeedPos + vec2(32.0f*(i-m_MaxGrowing) - 16.0f + random_float()*32.0f, 32.0f*(j-m_MaxGrowing) - 16.0f + random_float()*32.0f);
+			m_pGrowingMapVec[j*m_GrowingMap_Length+i] = EndPoint;
+
+			int NumPossibleStartPoint = 0;
+			vec2 PossibleStartPoint[4];
+
+			if(FromLeft)
+			{
+				PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[j*m_GrowingMap_Length+i-1];
+				NumPossibleStartPoint++;
+			}
+			if(FromRight)
+			{
+				PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[j*m_GrowingMap_Length+i+1];
+				NumPossibleStartPoint++;
+			}
+			if(FromTop)
+			{
+				PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[(j-1)*m_GrowingMap_Length+i];
+				NumPossibleStartPoint++;
+			}
+			if(FromBottom)
+			{
+				PossibleStartPoint[NumPossibleStartPoint] = m_pGrowingMapVec[(j+1)*m_GrowingMap_Length+i];
+				NumPossibleStartPoint++;
+			}
+
+			if(NumPossibleStartPoint > 0)
+			{
+				int randNb = random_int(0, NumPossibleStartPoint-1);
+				vec2 StartPoint = PossibleStartPoint[randNb];
+				GameServer()->CreateLaserDotEvent(StartPoint, EndPoint, Server()->TickSpeed()/6);
+			}
+
+			if(random_prob(0.1f))
+			{
+				GameServer()->CreateSound(EndPoint, SOUND_LASER_BOUNCE);
+			}
+		}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
 void CGrowingExplosion::TickPaused()
 {
 	++m_StartTick;
@@ -40,6 +40,7 @@ public:
 	void SetTriggeredBy(int CID);
 
 private:
+	void GrowTiles(int Tick);
 	void ProcessMercenaryBombHit(CInfClassCharacter *pCharacter);
 
 	int m_MaxGrowing;
@@ -56,6 +57,9 @@ private:
 	int m_StartTick;
 	std::vector<int> m_pGrowingMap;
 	std::vector<vec2> m_pGrowingMapVec;
+	// Grown tiles which have not spread to their neighbours yet
+	std::vector<int> m_GrowingFrontier;
+	std::vector<int> m_NewTiles;
 	GROWING_EXPLOSION_EFFECT m_ExplosionEffect = GROWING_EXPLOSION_EFFECT::INVALID;
 	bool m_Hit[MAX_CLIENTS];
 	int m_Damage = -1;
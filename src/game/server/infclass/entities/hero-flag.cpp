@@ -33,7 +33,9 @@ CHeroFlag::~CHeroFlag()
 
 void CHeroFlag::FindPosition()
 {
-	m_HasSpawnPosition = GameController()->GetHeroFlagPosition(&m_Pos);
+	vec2 Position = m_Pos;
+	m_HasSpawnPosition = GameController()->GetHeroFlagPosition(&Position);
+	SetPos(Position);
 }
 
 void CHeroFlag::ResetCooldown()
@@ -29,6 +29,12 @@ bool CPlacedObject::DoSnapForClient(int SnappingClient)
 	return true;
 }
 
+int CPlacedObject::LaserSnapVariant(int SnappingClient)
+{
+	// CGameContext::SnapLaserObject() sends a different object to the old clients
+	return GameServer()->GetClientVersion(SnappingClient) >= VERSION_DDNET_MULTI_LASER ? 1 : 0;
+}
+
 CNetObj_InfClassObject *CPlacedObject::SnapInfClassObject()
 {
 	CNetObj_InfClassObject *pInfClassObject = Server()->SnapNewItem<CNetObj_InfClassObject>(m_InfClassObjectID);
@@ -17,8 +17,10 @@ protected:
 	bool DoSnapForClient(int SnappingClient) override;
 
 	CNetObj_InfClassObject *SnapInfClassObject();
+	int LaserSnapVariant(int SnappingClient);
 
 protected:
+	CSnapItemCache m_SnapCache;
 	vec2 m_Pos2;
 	int m_InfClassObjectID = -1;
 	int m_InfClassObjectType = -1;
@@ -24,6 +24,8 @@
 #include <game/server/infclass/infcgamecontroller.h>
 #include <game/server/infclass/infcplayer.h>
 
+#include <algorithm>
+
 MACRO_ALLOC_POOL_ID_IMPL(CInfClassCharacter, MAX_CLIENTS)
 
 static bool HumansEntitiesFilter(const CEntity *pEntity)
@@ -2530,14 +2532,12 @@ void CInfClassCharacter::DestroyChildEntities()
 		CGameWorld::ENTTYPE_HERO_FLAG,
 	};
 
-	for(const auto EntityType : InfCEntities) {
-		for(CInfCEntity *p = (CInfCEntity*) GameWorld()->FindFirst(EntityType); p; p = (CInfCEntity*) p->TypeNext())
-		{
-			if(p->GetOwner() != m_pPlayer->GetCID())
-				continue;
+	for(CInfCEntity *p = CInfCEntity::FirstOwnedEntity(m_pPlayer->GetCID()); p; p = p->OwnedNext())
+	{
+		if(std::find(InfCEntities.begin(), InfCEntities.end(), p->GetObjType()) == InfCEntities.end())
+			continue;
 
-			GameServer()->m_World.DestroyEntity(p);
-		}
+		GameServer()->m_World.DestroyEntity(p);
 	}
 
 	m_HookMode = 0;
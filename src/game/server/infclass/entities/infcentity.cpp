@@ -7,6 +7,8 @@
 #include <game/server/infclass/entities/infccharacter.h>
 #include <game/server/infclass/infcgamecontroller.h>
 
+CInfCEntity *CInfCEntity::ms_apFirstOwned[MAX_CLIENTS] = {nullptr};
+
 static int FilterOwnerID = -1;
 static icArray<const CEntity *, 10> aFilterEntities;
 
@@ -26,6 +28,12 @@ CInfCEntity::CInfCEntity(CGameContext *pGameContext, int ObjectType, vec2 Pos, i
 	: CEntity(pGameContext->GameWorld(), ObjectType, Pos, ProximityRadius)
 	, m_Owner(Owner)
 {
+	LinkOwner();
+}
+
+CInfCEntity::~CInfCEntity()
+{
+	UnlinkOwner();
 }
 
 CInfClassGameController *CInfCEntity::GameController()
@@ -33,6 +41,16 @@ CInfClassGameController *CInfCEntity::GameController()
 	return static_cast<CInfClassGameController*>(GameServer()->m_pController);
 }
 
+void CInfCEntity::SetOwner(int Owner)
+{
+	if(Owner == m_Owner)
+		return;
+
+	UnlinkOwner();
+	m_Owner = Owner;
+	LinkOwner();
+}
+
 CInfClassCharacter *CInfCEntity::GetOwnerCharacter()
 {
 	return GameController()->GetCharacter(GetOwner());
@@ -64,6 +82,41 @@ EntityFilter CInfCEntity::GetExceptEntitiesFilterFunction(const icArray<const CE
 	return ExceptEntitiesFilter;
 }
 
+CInfCEntity *CInfCEntity::FirstOwnedEntity(int Owner)
+{
+	if(Owner < 0 || Owner >= MAX_CLIENTS)
+		return nullptr;
+
+	return ms_apFirstOwned[Owner];
+}
+
+void CInfCEntity::LinkOwner()
+{
+	if(m_Owner < 0 || m_Owner >= MAX_CLIENTS)
+		return;
+
+	m_pPrevOwned = nullptr;
+	m_pNextOwned = ms_apFirstOwned[m_Owner];
+	if(m_pNextOwned)
+		m_pNextOwned->m_pPrevOwned = this;
+	ms_apFirstOwned[m_Owner] = this;
+}
+
+void CInfCEntity::UnlinkOwner()
+{
+	if(m_Owner < 0 || m_Owner >= MAX_CLIENTS)
+		return;
+
+	if(m_pPrevOwned)
+		m_pPrevOwned->m_pNextOwned = m_pNextOwned;
+	else
+		ms_apFirstOwned[m_Owner] = m_pNextOwned;
+	if(m_pNextOwned)
+		m_pNextOwned->m_pPrevOwned = m_pPrevOwned;
+	m_pPrevOwned = nullptr;
+	m_pNextOwned = nullptr;
+}
+
 void CInfCEntity::Reset()
 {
 	GameWorld()->DestroyEntity(this);
@@ -77,11 +130,6 @@ void CInfCEntity::Tick()
 	}
 }
 
-void CInfCEntity::SetPos(const vec2 &Position)
-{
-	m_Pos = Position;
-}
-
 void CInfCEntity::SetAnimatedPos(const vec2 &Pivot, const vec2 &RelPosition, int PosEnv)
 {
 	m_Pivot = Pivot;
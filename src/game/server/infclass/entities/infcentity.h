@@ -23,9 +23,11 @@ class CInfCEntity : public CEntity
 public:
 	CInfCEntity(CGameContext *pGameContext, int ObjectType, vec2 Pos = vec2(), int Owner = -1,
 	            int ProximityRadius=0);
+	~CInfCEntity() override;
 
 	CInfClassGameController *GameController();
 	int GetOwner() const { return m_Owner; }
+	void SetOwner(int Owner);
 	CInfClassCharacter *GetOwnerCharacter();
 	CInfClassPlayerClass *GetOwnerClass();
 
@@ -34,10 +36,35 @@ public:
 
 	static EntityFilter GetExceptEntitiesFilterFunction(const icArray<const CEntity *, 10> &aEntities);
 
+	// The entities owned by a player, of all types, the newest first
+	static CInfCEntity *FirstOwnedEntity(int Owner);
+	CInfCEntity *OwnedNext() { return m_pNextOwned; }
+
+	template<typename T>
+	static T *FindFirstOwned(int Owner)
+	{
+		for(CInfCEntity *p = FirstOwnedEntity(Owner); p; p = p->m_pNextOwned)
+		{
+			if(p->m_ObjType == T::EntityId)
+				return static_cast<T *>(p);
+		}
+		return nullptr;
+	}
+
+	// The callback may destroy the entity, which is only marked until the end of the tick
+	template<typename T, typename F>
+	static void ForEachOwnedEntity(int Owner, F &&Callback)
+	{
+		for(CInfCEntity *p = FirstOwnedEntity(Owner); p; p = p->m_pNextOwned)
+		{
+			if(p->m_ObjType == T::EntityId)
+				Callback(static_cast<T *>(p));
+		}
+	}
+
 	void Reset() override;
 	void Tick() override;
 
-	void SetPos(const vec2 &Position);
 	void SetAnimatedPos(const vec2 &Pivot, const vec2 &RelPosition, int PosEnv);
 
 protected:
@@ -48,6 +75,15 @@ protected:
 	vec2 m_Pivot;
 	vec2 m_RelPosition;
 	int m_PosEnv = -1;
+
+private:
+	void LinkOwner();
+	void UnlinkOwner();
+
+	// the heads of the per owner lists, there is only one game world
+	static CInfCEntity *ms_apFirstOwned[MAX_CLIENTS];
+	CInfCEntity *m_pPrevOwned = nullptr;
+	CInfCEntity *m_pNextOwned = nullptr;
 };
 
 #endif // GAME_SERVER_ENTITIES_INFC_ENTITY_H
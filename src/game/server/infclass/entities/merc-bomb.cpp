@@ -112,18 +112,22 @@ void CMercenaryBomb::Snap(int SnappingClient)
 	float AngleStart = (2.0f * pi * Server()->Tick()/static_cast<float>(Server()->TickSpeed()))/10.0f;
 	float AngleStep = 2.0f * pi / static_cast<float>(CMercenaryBomb::NUM_SIDE);
 	float R = 50.0f * static_cast<float>(m_Load) / Config()->m_InfMercBombs;
-	for(int i = 0; i < CMercenaryBomb::NUM_SIDE; i++)
+	if(m_SnapCache.Begin(Server(), SnappingClient))
 	{
-		vec2 PosStart = m_Pos + vec2(R * cos(AngleStart + AngleStep*i), R * sin(AngleStart + AngleStep*i));
+		for(int i = 0; i < CMercenaryBomb::NUM_SIDE; i++)
+		{
+			vec2 PosStart = m_Pos + vec2(R * cos(AngleStart + AngleStep*i), R * sin(AngleStart + AngleStep*i));
 
-		CNetObj_Pickup *pP = Server()->SnapNewItem<CNetObj_Pickup>(m_IDs[i]);
-		if(!pP)
-			return;
+			CNetObj_Pickup *pP = Server()->SnapNewItem<CNetObj_Pickup>(m_IDs[i]);
+			if(!pP)
+				break;
 
-		pP->m_X = (int)PosStart.x;
-		pP->m_Y = (int)PosStart.y;
-		pP->m_Type = POWERUP_HEALTH;
-		pP->m_Subtype = 0;
+			pP->m_X = (int)PosStart.x;
+			pP->m_Y = (int)PosStart.y;
+			pP->m_Type = POWERUP_HEALTH;
+			pP->m_Subtype = 0;
+		}
+		m_SnapCache.End(Server());
 	}
 
 	if(SnappingClient == m_Owner && m_LoadingTick > 0)
@@ -31,7 +31,7 @@ bool CMercenaryLaser::HitCharacter(vec2 From, vec2 To)
 		pMercClass->UpgradeMercBomb(pBomb, m_UpgradePoints);
 
 		m_From = From;
-		m_Pos = At;
+		SetPos(At);
 		m_Energy = -1;
 		return true;
 	}
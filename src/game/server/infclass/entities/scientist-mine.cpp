@@ -91,11 +91,15 @@ void CScientistMine::Snap(int SnappingClient)
 	
 	float AngleStep = 2.0f * pi / NumSide;
 	
-	for(int i=0; i<NumSide; i++)
+	if(m_SnapCache.Begin(Server(), SnappingClient, LaserSnapVariant(SnappingClient) * 2 + AntiPing))
 	{
-		vec2 PartPosStart = m_Pos + direction(AngleStep * i) * Radius;
-		vec2 PartPosEnd = m_Pos + direction(AngleStep * (i + 1)) * Radius;
-		GameServer()->SnapLaserObject(Context, m_IDs[i], PartPosStart, PartPosEnd, Server()->Tick(), GetOwner());
+		for(int i=0; i<NumSide; i++)
+		{
+			vec2 PartPosStart = m_Pos + direction(AngleStep * i) * Radius;
+			vec2 PartPosEnd = m_Pos + direction(AngleStep * (i + 1)) * Radius;
+			GameServer()->SnapLaserObject(Context, m_IDs[i], PartPosStart, PartPosEnd, Server()->Tick(), GetOwner());
+		}
+		m_SnapCache.End(Server());
 	}
 
 	if(!AntiPing)
@@ -81,7 +81,7 @@ bool CSlugSlime::Replenish(int PlayerID, int EndTick)
 	if(m_EndTick > EndTick)
 		return false;
 
-	m_Owner = PlayerID;
+	SetOwner(PlayerID);
 	m_EndTick = EndTick;
 	return true;
 }
@@ -13,8 +13,10 @@
 
 constexpr float SoldierBombRadius = 60.0f;
 
+int CSoldierBomb::EntityId = CGameWorld::ENTTYPE_SOLDIER_BOMB;
+
 CSoldierBomb::CSoldierBomb(CGameContext *pGameContext, vec2 Pos, int Owner) :
-	CPlacedObject(pGameContext, CGameWorld::ENTTYPE_SOLDIER_BOMB, Pos, Owner, SoldierBombRadius)
+	CPlacedObject(pGameContext, EntityId, Pos, Owner, SoldierBombRadius)
 {
 	m_InfClassObjectType = INFCLASS_OBJECT_TYPE_SOLDIER_BOMB;
 	GameWorld()->InsertEntity(this);
@@ -120,6 +122,9 @@ void CSoldierBomb::Snap(int SnappingClient)
 		}
 	}
 
+	if(!m_SnapCache.Begin(Server(), SnappingClient))
+		return;
+
 	for(int i = 0; i < m_nbBomb; i++)
 	{
 		float shiftedAngle = m_Angle + 2.0 * pi * static_cast<float>(i) / static_cast<float>(m_IDBomb.size());
@@ -132,6 +137,7 @@ void CSoldierBomb::Snap(int SnappingClient)
 		pProj->m_StartTick = Server()->Tick();
 		pProj->m_Type = WEAPON_GRENADE;
 	}
+	m_SnapCache.End(Server());
 }
 
 void CSoldierBomb::Tick()
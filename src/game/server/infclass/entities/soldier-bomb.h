@@ -10,6 +10,8 @@
 class CSoldierBomb : public CPlacedObject
 {
 public:
+	static int EntityId;
+
 	CSoldierBomb(CGameContext *pGameContext, vec2 Pos, int Owner);
 	~CSoldierBomb() override;
 
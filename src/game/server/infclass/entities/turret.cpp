@@ -210,6 +210,9 @@ void CTurret::Snap(int SnappingClient)
 	int SnappingClientVersion = GameServer()->GetClientVersion(SnappingClient);
 	CSnapContext Context(SnappingClientVersion);
 
+	if(!m_SnapCache.Begin(Server(), SnappingClient, LaserSnapVariant(SnappingClient) * 2 + AntiPing))
+		return;
+
 	float time = (Server()->Tick() - m_StartTick) / (float)Server()->TickSpeed();
 	float angle = fmodf(time * pi / 2, 2.0f * pi);
 	GameServer()->SnapLaserObject(Context, GetID(), m_Pos, m_Pos, Server()->Tick(), GetOwner());
@@ -221,6 +224,7 @@ void CTurret::Snap(int SnappingClient)
 		vec2 Direction = vec2(cos(shiftedAngle), sin(shiftedAngle));
 		GameController()->SendHammerDot(m_Pos + Direction * m_Radius, m_IDs[i]);
 	}
+	m_SnapCache.End(Server());
 }
 
 void CTurret::Die(CInfClassCharacter *pKiller)
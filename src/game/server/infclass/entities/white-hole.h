@@ -7,6 +7,9 @@
 
 class CWhiteHole : public CInfCEntity
 {
+public:
+	static int EntityId;
+
 private:
 	void StartVisualEffect();
 	void MoveParticles();
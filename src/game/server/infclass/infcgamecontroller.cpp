@@ -166,8 +166,6 @@ CInfClassGameController::CInfClassGameController(class CGameContext *pGameServer
 	m_pGameType = "InfClassR";
 
 	m_Teams.m_Core.m_IsInfclass = true;
-	
-	m_GrowingMap = 0;
 
 	//Get zones
 	m_ZoneHandle_icDamage = GameServer()->Collision()->GetZoneHandle("icDamage");
@@ -177,7 +175,8 @@ CInfClassGameController::CInfClassGameController(class CGameContext *pGameServer
 	m_ExplosionStarted = false;
 	m_MapWidth = GameServer()->Collision()->GetWidth();
 	m_MapHeight = GameServer()->Collision()->GetHeight();
-	m_GrowingMap = new int[m_MapWidth*m_MapHeight];
+	m_ExplosionBlocked.assign(m_MapWidth * m_MapHeight, false);
+	m_ExplosionReached.assign(m_MapWidth * m_MapHeight, false);
 
 	m_RoundType = GetDefaultRoundType();
 	m_QueuedRoundType = ERoundType::Invalid;
@@ -188,14 +187,7 @@ CInfClassGameController::CInfClassGameController(class CGameContext *pGameServer
 		for(int i=0; i<m_MapWidth; i++)
 		{
 			vec2 TilePos = vec2(16.0f, 16.0f) + vec2(i*32.0f, j*32.0f);
-			if(GameServer()->Collision()->CheckPoint(TilePos))
-			{
-				m_GrowingMap[j*m_MapWidth+i] = 4;
-			}
-			else
-			{
-				m_GrowingMap[j*m_MapWidth+i] = 1;
-			}
+			m_ExplosionBlocked[j * m_MapWidth + i] = GameServer()->Collision()->CheckPoint(TilePos);
 		}
 	}
 
@@ -205,8 +197,6 @@ CInfClassGameController::CInfClassGameController(class CGameContext *pGameServer
 CInfClassGameController::~CInfClassGameController()
 {
 	FreePlayerOwnSnapItems();
-
-	if(m_GrowingMap) delete[] m_GrowingMap;
 }
 
 void CInfClassGameController::IncreaseCurrentRoundCounter()
@@ -487,7 +477,13 @@ bool CInfClassGameController::OnEntity(const char* pName, vec2 Pivot, vec2 P0, v
 		
 		if(SpawnX >= 0 && SpawnX < m_MapWidth && SpawnY >= 0 && SpawnY < m_MapHeight)
 		{
-			m_GrowingMap[SpawnY*m_MapWidth+SpawnX] = 6;
+			const int Index = SpawnY * m_MapWidth + SpawnX;
+			if(!m_ExplosionReached[Index])
+			{
+				m_ExplosionBlocked[Index] = true;
+				m_ExplosionReached[Index] = true;
+				m_ExplosionSeeds.push_back(Index);
+			}
 		}
 	}
 	else if(str_comp(pName, "icHeroFlag") == 0)
@@ -914,17 +910,57 @@ void CInfClassGameController::SendServerParams(int ClientID) const
 void CInfClassGameController::ResetFinalExplosion()
 {
 	m_ExplosionStarted = false;
-	
-	for(int j=0; j<m_MapHeight; j++)
+
+	std::fill(m_ExplosionReached.begin(), m_ExplosionReached.end(), false);
+	for(int Index : m_ExplosionSeeds)
+		m_ExplosionReached[Index] = true;
+
+	m_ExplosionFrontier.clear();
+	m_ExplosionNextFrontier.clear();
+}
+
+bool CInfClassGameController::GrowFinalExplosion()
+{
+	m_ExplosionNextFrontier.clear();
+
+	// Every tile reached on the previous step spreads the explosion to its
+	// free neighbours, so each tile is visited once per round.
+	for(int Index : m_ExplosionFrontier)
 	{
-		for(int i=0; i<m_MapWidth; i++)
+		const int i = Index % m_MapWidth;
+		const int j = Index / m_MapWidth;
+		const int aNeighbours[4] = {
+			i > 0 ? Index - 1 : -1,
+			i < m_MapWidth - 1 ? Index + 1 : -1,
+			j > 0 ? Index - m_MapWidth : -1,
+			j < m_MapHeight - 1 ? Index + m_MapWidth : -1,
+		};
+
+		for(int Neighbour : aNeighbours)
 		{
-			if(!(m_GrowingMap[j*m_MapWidth+i] & 4))
-			{
-				m_GrowingMap[j*m_MapWidth+i] = 1;
-			}
+			if(Neighbour < 0 || m_ExplosionBlocked[Neighbour] || m_ExplosionReached[Neighbour])
+				continue;
+
+			m_ExplosionReached[Neighbour] = true;
+			m_ExplosionNextFrontier.push_back(Neighbour);
+		}
+	}
+
+	for(int Index : m_ExplosionNextFrontier)
+	{
+		if(random_prob(0.1f))
+		{
+			const int i = Index % m_MapWidth;
+			const int j = Index / m_MapWidth;
+			vec2 TilePos = vec2(16.0f, 16.0f) + vec2(i * 32.0f, j * 32.0f);
+			static const int Damage = 0;
+			CreateExplosion(TilePos, -1, EDamageType::NO_DAMAGE, Damage);
+			GameServer()->CreateSound(TilePos, SOUND_GRENADE_EXPLODE);
 		}
 	}
+
+	std::swap(m_ExplosionFrontier, m_ExplosionNextFrontier);
+	return !m_ExplosionFrontier.empty();
 }
 
 void CInfClassGameController::SaveRoundRules()
@@ -2157,7 +2193,7 @@ void CInfClassGameController::ConLoadPosition(IConsole::IResult *pResult)
 
 	pPlayer->LoadSavedPosition(&Position);
 
-	pCharacter->m_Pos = Position;
+	pCharacter->SetPos(Position);
 	pCharacter->SetPosition(Position);
 	pCharacter->ResetVelocity();
 	GameWorld()->ReleaseHooked(ClientID);
@@ -4979,50 +5015,14 @@ void CInfClassGameController::DoWincheck()
 				GameServer()->SendEmoticon(p->GetCID(), EMOTICON_EYES);
 			}
 		}
+		m_ExplosionFrontier = m_ExplosionSeeds;
 		m_ExplosionStarted = true;
 	}
 
 	//Do the final explosion
 	if(m_ExplosionStarted)
 	{
-		bool NewExplosion = false;
-
-		for(int j=0; j<m_MapHeight; j++)
-		{
-			for(int i=0; i<m_MapWidth; i++)
-			{
-				if((m_GrowingMap[j*m_MapWidth+i] & 1) && (
-					(i > 0 && m_GrowingMap[j*m_MapWidth+i-1] & 2) ||
-					(i < m_MapWidth-1 && m_GrowingMap[j*m_MapWidth+i+1] & 2) ||
-					(j > 0 && m_GrowingMap[(j-1)*m_MapWidth+i] & 2) ||
-					(j < m_MapHeight-1 && m_GrowingMap[(j+1)*m_MapWidth+i] & 2)
-				))
-				{
-					NewExplosion = true;
-					m_GrowingMap[j*m_MapWidth+i] |= 8;
-					m_GrowingMap[j*m_MapWidth+i] &= ~1;
-					if(random_prob(0.1f))
-					{
-						vec2 TilePos = vec2(16.0f, 16.0f) + vec2(i*32.0f, j*32.0f);
-						static const int Damage = 0;
-						CreateExplosion(TilePos, -1, EDamageType::NO_DAMAGE, Damage);
-						GameServer()->CreateSound(TilePos, SOUND_GRENADE_EXPLODE);
-					}
-				}
-			}
-		}
-
-		for(int j=0; j<m_MapHeight; j++)
-		{
-			for(int i=0; i<m_MapWidth; i++)
-			{
-				if(m_GrowingMap[j*m_MapWidth+i] & 8)
-				{
-					m_GrowingMap[j*m_MapWidth+i] &= ~8;
-					m_GrowingMap[j*m_MapWidth+i] |= 2;
-				}
-			}
-		}
+		bool NewExplosion = GrowFinalExplosion();
 
 		for(TEntityPtr<CInfClassCharacter> p = GameWorld()->FindFirst<CInfClassCharacter>(); p; ++p)
 		{
@@ -5037,7 +5037,7 @@ void CInfClassGameController::DoWincheck()
 			if(tileY < 0) tileY = 0;
 			if(tileY >= m_MapHeight) tileY = m_MapHeight-1;
 
-			if(m_GrowingMap[tileY*m_MapWidth+tileX] & 2 && p->GetPlayer())
+			if(m_ExplosionReached[tileY*m_MapWidth+tileX] && p->GetPlayer())
 			{
 				p->Die(p->GetCID(), EDamageType::GAME_FINAL_EXPLOSION);
 			}
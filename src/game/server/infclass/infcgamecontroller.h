@@ -11,6 +11,8 @@
 #include <base/tl/ic_array.h>
 #include <engine/console.h>
 
+#include <vector>
+
 class CGameWorld;
 class CHintMessage;
 class CInfClassCharacter;
@@ -187,6 +189,7 @@ public:
 	void EndSurvivalRound();
 
 	void ResetFinalExplosion();
+	bool GrowFinalExplosion();
 	void SaveRoundRules();
 	void StartSurvivalGame();
 	void EndSurvivalGame();
@@ -365,7 +368,14 @@ private:
 
 	int m_MapWidth;
 	int m_MapHeight;
-	int* m_GrowingMap;
+	// Final explosion state, one bit per tile
+	std::vector<bool> m_ExplosionBlocked;
+	std::vector<bool> m_ExplosionReached;
+	// Tiles where the final explosion starts (icInfected spawns)
+	std::vector<int> m_ExplosionSeeds;
+	// Tiles reached by the previous step, expanded on the next one
+	std::vector<int> m_ExplosionFrontier;
+	std::vector<int> m_ExplosionNextFrontier;
 	bool m_ExplosionStarted;
 
 	CGameTeams m_Teams;
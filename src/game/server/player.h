@@ -176,6 +176,7 @@ protected:
 	EPlayerClass m_class;
 	int m_DefaultScoreMode;
 	char m_aLanguage[16];
+	int m_LanguageID = -1;
 
 public:
 	EPlayerClass GetClass() const;
@@ -184,6 +185,8 @@ public:
 	bool IsSpectator() const;
 
 	const char *GetLanguage() const;
+	// CLocalization::GetLanguageID() of the language, -1 for the main language
+	int GetLanguageID() const { return m_LanguageID; }
 	void SetLanguage(const char* pLanguage);
 
 	void SetOriginalName(const char *pName);
@@ -7,6 +7,108 @@
 #include <unicode/ubidi.h>
 /* END EDIT ***********************************************************/
 
+//windows
+#if defined(CONF_FAMILY_WINDOWS) && !defined(va_copy)
+	#define va_copy(d,s) ((d) = (s))
+#endif
+
+/* TEMPLATE ***********************************************************/
+
+CLocalization::CTemplate::CTemplate(const char* pText)
+{
+	int Length = str_length(pText)+1;
+	m_pText = new char[Length];
+	str_copy(m_pText, pText, Length);
+	
+	int Iter = 0;
+	int Start = Iter;
+	int ParamTypeStart = -1;
+	int ParamNameStart = -1;
+	int ParamNameLength = 0;
+	
+	while(m_pText[Iter])
+	{
+		if(ParamNameStart >= 0)
+		{
+			if(m_pText[Iter] == '}') //End of the macro, add the argument if its type is known
+			{
+				CToken Token;
+				Token.m_Type = -1;
+				if(str_comp_num("str:", m_pText+ParamTypeStart, 4) == 0)
+					Token.m_Type = TOKEN_STR;
+				else if(str_comp_num("int:", m_pText+ParamTypeStart, 4) == 0)
+					Token.m_Type = TOKEN_INT;
+				else if(str_comp_num("percent:", m_pText+ParamTypeStart, 4) == 0)
+					Token.m_Type = TOKEN_PERCENT;
+				else if(str_comp_num("sec:", m_pText+ParamTypeStart, 4) == 0)
+					Token.m_Type = TOKEN_SEC;
+				
+				if(Token.m_Type >= 0)
+				{
+					Token.m_Offset = ParamNameStart;
+					Token.m_Length = ParamNameLength;
+					m_Tokens.add(Token);
+				}
+				
+				//Close the macro
+				Start = Iter+1;
+				ParamTypeStart = -1;
+				ParamNameStart = -1;
+			}
+			else
+				ParamNameLength++;
+		}
+		else if(ParamTypeStart >= 0)
+		{
+			if(m_pText[Iter] == ':') //End of the type, start of the name
+			{
+				ParamNameStart = Iter+1;
+				ParamNameLength = 0;
+			}
+			else if(m_pText[Iter] == '}') //Invalid: no name found
+			{
+				//Close the macro
+				Start = Iter+1;
+				ParamTypeStart = -1;
+				ParamNameStart = -1;
+			}
+		}
+		else
+		{
+			if(m_pText[Iter] == '{')
+			{
+				//Flush the literal text
+				if(Iter > Start)
+				{
+					CToken Token;
+					Token.m_Type = TOKEN_TEXT;
+					Token.m_Offset = Start;
+					Token.m_Length = Iter-Start;
+					m_Tokens.add(Token);
+				}
+				Iter++;
+				ParamTypeStart = Iter;
+			}
+		}
+		
+		Iter = str_utf8_forward(m_pText, Iter);
+	}
+	
+	if(Iter > Start && ParamTypeStart == -1 && ParamNameStart == -1)
+	{
+		CToken Token;
+		Token.m_Type = TOKEN_TEXT;
+		Token.m_Offset = Start;
+		Token.m_Length = Iter-Start;
+		m_Tokens.add(Token);
+	}
+}
+
+CLocalization::CTemplate::~CTemplate()
+{
+	delete[] m_pText;
+}
+
 /* LANGUAGE ***********************************************************/
 
 CLocalization::CLanguage::CLanguage() :
@@ -216,6 +318,20 @@ bool CLocalization::CLanguage::Load(CLocalization* pLocalization, CStorage* pSto
 		}
 	}
 
+	// parse the placeholders of the translations only once
+	hashtable< CEntry, 128 >::iterator Iter = m_Translations.begin();
+	while(Iter != m_Translations.end())
+	{
+		CEntry* pEntry = Iter.data();
+		for(int i=0; i<NUM_PLURALTYPES; i++)
+		{
+			if(pEntry->m_apVersions[i] && !pEntry->m_apTemplates[i])
+				pEntry->m_apTemplates[i] = new CTemplate(pEntry->m_apVersions[i]);
+		}
+		
+		++Iter;
+	}
+
 	// clean up
 	json_value_free(pJsonData);
 	delete[] pFileData;
@@ -234,18 +350,14 @@ const char* CLocalization::CLanguage::Localize(const char* pText) const
 	return pEntry->m_apVersions[PLURALTYPE_NONE];
 }
 
-const char* CLocalization::CLanguage::Localize_P(int Number, const char* pText) const
+int CLocalization::CLanguage::PluralType(int Number) const
 {
-	const CEntry* pEntry = m_Translations.get(pText);
-	if(!pEntry)
-		return NULL;
-	
 	UChar aPluralKeyWord[6];
 	UErrorCode Status = U_ZERO_ERROR;
 	uplrules_select(m_pPluralRules, static_cast<double>(Number), aPluralKeyWord, 6, &Status);
 	
 	if(U_FAILURE(Status))
-		return NULL;
+		return -1;
 	
 	int PluralCode = PLURALTYPE_NONE;
 	
@@ -265,16 +377,52 @@ const char* CLocalization::CLanguage::Localize_P(int Number, const char* pText)
 			PluralCode = PLURALTYPE_ONE;
 	}
 	
+	return PluralCode;
+}
+
+const char* CLocalization::CLanguage::Localize_P(int Number, const char* pText) const
+{
+	const CEntry* pEntry = m_Translations.get(pText);
+	if(!pEntry)
+		return NULL;
+	
+	int PluralCode = PluralType(Number);
+	if(PluralCode < 0)
+		return NULL;
+	
 	return pEntry->m_apVersions[PluralCode];
 }
 
+const CLocalization::CTemplate* CLocalization::CLanguage::LocalizeTemplate(const char* pText) const
+{
+	const CEntry* pEntry = m_Translations.get(pText);
+	if(!pEntry)
+		return NULL;
+	
+	return pEntry->m_apTemplates[PLURALTYPE_NONE];
+}
+
+const CLocalization::CTemplate* CLocalization::CLanguage::LocalizeTemplate_P(int Number, const char* pText) const
+{
+	const CEntry* pEntry = m_Translations.get(pText);
+	if(!pEntry)
+		return NULL;
+	
+	int PluralCode = PluralType(Number);
+	if(PluralCode < 0)
+		return NULL;
+	
+	return pEntry->m_apTemplates[PluralCode];
+}
+
 /* LOCALIZATION *******************************************************/
 
 /* BEGIN EDIT *********************************************************/
 CLocalization::CLocalization(class CStorage* pStorage) :
 	m_pStorage(pStorage),
 	m_pMainLanguage(NULL),
-	m_pUtf8Converter(NULL)
+	m_pUtf8Converter(NULL),
+	m_NumSourceTemplates(0)
 {
 	
 }
@@ -285,6 +433,15 @@ CLocalization::~CLocalization()
 	for(int i=0; i<m_pLanguages.size(); i++)
 		delete m_pLanguages[i];
 	
+	hashtable< CTemplate*, 512 >::iterator Iter = m_SourceTemplates.begin();
+	while(Iter != m_SourceTemplates.end())
+	{
+		if(Iter.data())
+			delete *Iter.data();
+		
+		++Iter;
+	}
+	
 	if(m_pUtf8Converter)
 		ucnv_close(m_pUtf8Converter);
 }
@@ -345,6 +502,8 @@ bool CLocalization::Init()
 		{
 			CLanguage*& pLanguage = m_pLanguages.increment();
 			pLanguage = new CLanguage((const char *)rStart[i]["name"], (const char *)rStart[i]["file"], (const char *)rStart[i]["parent"]);
+			if(!m_LanguageIDs.get(pLanguage->GetFilename()))
+				*m_LanguageIDs.set(pLanguage->GetFilename()) = m_pLanguages.size()-1;
 				
 			if((const char *)rStart[i]["direction"] && str_comp((const char *)rStart[i]["direction"], "rtl") == 0)
 				pLanguage->SetWritingDirection(DIRECTION_RTL);
@@ -581,21 +740,24 @@ const char *CLocalization::FallbackLanguageForIpCountryCode(int Country)
 	}
 }
 
-const char* CLocalization::LocalizeWithDepth(const char* pLanguageCode, const char* pText, int Depth)
+int CLocalization::GetLanguageID(const char* pLanguageCode) const
 {
-	CLanguage* pLanguage = m_pMainLanguage;
-	if(pLanguageCode)
-	{
-		for(int i=0; i<m_pLanguages.size(); i++)
-		{
-			if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) == 0)
-			{
-				pLanguage = m_pLanguages[i];
-				break;
-			}
-		}
-	}
+	if(!pLanguageCode)
+		return -1;
 	
+	const int* pID = m_LanguageIDs.get(pLanguageCode);
+	return pID ? *pID : -1;
+}
+
+CLocalization::CLanguage* CLocalization::FindLanguage(const char* pLanguageCode)
+{
+	int ID = GetLanguageID(pLanguageCode);
+	return ID >= 0 ? m_pLanguages[ID] : m_pMainLanguage;
+}
+
+const char* CLocalization::LocalizeWithDepth(const char* pLanguageCode, const char* pText, int Depth)
+{
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
 	if(!pLanguage)
 		return pText;
 	
@@ -618,19 +780,7 @@ const char* CLocalization::Localize(const char* pLanguageCode, const char* pText
 
 const char* CLocalization::LocalizeWithDepth_P(const char* pLanguageCode, int Number, const char* pText, int Depth)
 {
-	CLanguage* pLanguage = m_pMainLanguage;
-	if(pLanguageCode)
-	{
-		for(int i=0; i<m_pLanguages.size(); i++)
-		{
-			if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) == 0)
-			{
-				pLanguage = m_pLanguages[i];
-				break;
-			}
-		}
-	}
-	
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
 	if(!pLanguage)
 		return pText;
 	
@@ -651,6 +801,61 @@ const char* CLocalization::Localize_P(const char* pLanguageCode, int Number, con
 	return LocalizeWithDepth_P(pLanguageCode, Number, pText, 0);
 }
 
+const CLocalization::CTemplate* CLocalization::LocalizeTemplateWithDepth(const char* pLanguageCode, const char* pText, int Depth, CTemplate*& pUncached)
+{
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
+	if(!pLanguage)
+		return SourceTemplate(pText, pUncached);
+	
+	if(!pLanguage->IsLoaded())
+		pLanguage->Load(this, Storage());
+	
+	const CTemplate* pResult = pLanguage->LocalizeTemplate(pText);
+	if(pResult)
+		return pResult;
+	else if(pLanguage->GetParentFilename()[0] && Depth < 4)
+		return LocalizeTemplateWithDepth(pLanguage->GetParentFilename(), pText, Depth+1, pUncached);
+	else
+		return SourceTemplate(pText, pUncached);
+}
+
+const CLocalization::CTemplate* CLocalization::LocalizeTemplateWithDepth_P(const char* pLanguageCode, int Number, const char* pText, int Depth, CTemplate*& pUncached)
+{
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
+	if(!pLanguage)
+		return SourceTemplate(pText, pUncached);
+	
+	if(!pLanguage->IsLoaded())
+		pLanguage->Load(this, Storage());
+	
+	const CTemplate* pResult = pLanguage->LocalizeTemplate_P(Number, pText);
+	if(pResult)
+		return pResult;
+	else if(pLanguage->GetParentFilename()[0] && Depth < 4)
+		return LocalizeTemplateWithDepth_P(pLanguage->GetParentFilename(), Number, pText, Depth+1, pUncached);
+	else
+		return SourceTemplate(pText, pUncached);
+}
+
+const CLocalization::CTemplate* CLocalization::SourceTemplate(const char* pText, CTemplate*& pUncached)
+{
+	CTemplate** ppTemplate = m_SourceTemplates.get(pText);
+	if(ppTemplate)
+		return *ppTemplate;
+	
+	//don't let texts built at runtime grow the cache forever
+	if(m_NumSourceTemplates >= MAX_SOURCE_TEMPLATES)
+	{
+		pUncached = new CTemplate(pText);
+		return pUncached;
+	}
+	
+	CTemplate* pTemplate = new CTemplate(pText);
+	*m_SourceTemplates.set(pText) = pTemplate;
+	m_NumSourceTemplates++;
+	return pTemplate;
+}
+
 void CLocalization::AppendNumber(dynamic_string& Buffer, int& BufferIter, CLanguage* pLanguage, int Number)
 {
 	UChar aBufUtf16[128];
@@ -732,145 +937,110 @@ void CLocalization::AppendDuration(dynamic_string& Buffer, int& BufferIter, CLan
 	}
 }
 
-void CLocalization::Format_V(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
+void CLocalization::FormatTemplate(dynamic_string& Buffer, CLanguage* pLanguage, const CTemplate* pTemplate, va_list VarArgs)
 {
-	CLanguage* pLanguage = m_pMainLanguage;	
-	if(pLanguageCode)
-	{
-		for(int i=0; i<m_pLanguages.size(); i++)
-		{
-			if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) == 0)
-			{
-				pLanguage = m_pLanguages[i];
-				break;
-			}
-		}
-	}
-	if(!pLanguage)
-	{
-		Buffer.append(pText);
-		return;
-	}
-	
-	const char* pVarArgName = NULL;
-	const void* pVarArgValue = NULL;
-	
-	int Iter = 0;
-	int Start = Iter;
-	int ParamTypeStart = -1;
-	int ParamTypeLength = 0;
-	int ParamNameStart = -1;
-	int ParamNameLength = 0;
+	//the arguments are read from the va_list only as far as they are needed
+	const char* apArgNames[MAX_FORMAT_ARGS];
+	const void* apArgValues[MAX_FORMAT_ARGS];
+	int NumArgs = 0;
+	bool ArgsEnd = false;
+	va_list VarArgsIter;
+	va_copy(VarArgsIter, VarArgs);
 	
 	int BufferStart = Buffer.length();
 	int BufferIter = BufferStart;
 	
-	while(pText[Iter])
+	for(int t=0; t<pTemplate->m_Tokens.size(); t++)
 	{
-		if(ParamNameStart >= 0)
+		const CTemplate::CToken& Token = pTemplate->m_Tokens[t];
+		const char* pTokenText = pTemplate->m_pText + Token.m_Offset;
+		if(Token.m_Type == CTemplate::TOKEN_TEXT)
+		{
+			BufferIter = Buffer.append_at_num(BufferIter, pTokenText, Token.m_Length);
+			continue;
+		}
+		
+		//Try to find an argument with this name
+		const void* pVarArgValue = NULL;
+		bool Found = false;
+		for(int i=0; i<NumArgs; i++)
 		{
-			if(pText[Iter] == '}') //End of the macro, try to apply it
+			if(str_comp_num(pTokenText, apArgNames[i], Token.m_Length) == 0)
 			{
-				//Try to find an argument with this name
-				va_list VarArgsIter;
-
-				//windows
-				#if defined(CONF_FAMILY_WINDOWS)
-					#define va_copy(d,s) ((d) = (s))
-				#endif
-
-				va_copy(VarArgsIter, VarArgs);
-				pVarArgName = va_arg(VarArgsIter, const char*);
-				while(pVarArgName)
-				{
-					pVarArgValue = va_arg(VarArgsIter, const void*);
-					if(str_comp_num(pText+ParamNameStart, pVarArgName, ParamNameLength) == 0)
-					{
-						//Get argument type
-						if(str_comp_num("str:", pText+ParamTypeStart, 4) == 0)
-						{
-							BufferIter = Buffer.append_at(BufferIter, (const char*) pVarArgValue);
-						}
-						else if(str_comp_num("int:", pText+ParamTypeStart, 4) == 0)
-						{
-							int Number = *((const int*) pVarArgValue);
-							AppendNumber(Buffer, BufferIter, pLanguage, Number);
-						}
-						else if(str_comp_num("percent:", pText+ParamTypeStart, 4) == 0)
-						{
-							float Number = (*((const float*) pVarArgValue));
-							AppendPercent(Buffer, BufferIter, pLanguage, Number);
-						}
-						else if(str_comp_num("sec:", pText+ParamTypeStart, 4) == 0)
-						{
-							int Duration = *((const int*) pVarArgValue);
-							int Minutes = Duration / 60;
-							int Seconds = Duration - Minutes*60;
-							if(Minutes > 0)
-							{
-								AppendDuration(Buffer, BufferIter, pLanguage, Minutes, icu::TimeUnit::UTIMEUNIT_MINUTE);
-								if(Seconds > 0)
-								{
-									BufferIter = Buffer.append_at(BufferIter, ", ");
-									AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
-								}
-							}
-							else
-								AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
-						}
-						break;
-					}
-					
-					pVarArgName = va_arg(VarArgsIter, const char*);
-				}
-				va_end(VarArgsIter);
-				
-				//Close the macro
-				Start = Iter+1;
-				ParamTypeStart = -1;
-				ParamNameStart = -1;
+				pVarArgValue = apArgValues[i];
+				Found = true;
+				break;
 			}
-			else
-				ParamNameLength++;
 		}
-		else if(ParamTypeStart >= 0)
+		while(!Found && !ArgsEnd)
 		{
-			if(pText[Iter] == ':') //End of the type, start of the name
+			const char* pVarArgName = va_arg(VarArgsIter, const char*);
+			if(!pVarArgName)
 			{
-				ParamNameStart = Iter+1;
-				ParamNameLength = 0;
+				ArgsEnd = true;
+				break;
 			}
-			else if(pText[Iter] == '}') //Invalid: no name found
+			pVarArgValue = va_arg(VarArgsIter, const void*);
+			if(NumArgs < MAX_FORMAT_ARGS)
 			{
-				//Close the macro
-				Start = Iter+1;
-				ParamTypeStart = -1;
-				ParamNameStart = -1;
+				apArgNames[NumArgs] = pVarArgName;
+				apArgValues[NumArgs] = pVarArgValue;
+				NumArgs++;
 			}
-			else
-				ParamTypeLength++;
+			Found = str_comp_num(pTokenText, pVarArgName, Token.m_Length) == 0;
 		}
-		else
+		if(!Found)
+			continue;
+		
+		switch(Token.m_Type)
 		{
-			if(pText[Iter] == '{')
+			case CTemplate::TOKEN_STR:
+				BufferIter = Buffer.append_at(BufferIter, (const char*) pVarArgValue);
+				break;
+			case CTemplate::TOKEN_INT:
+				AppendNumber(Buffer, BufferIter, pLanguage, *((const int*) pVarArgValue));
+				break;
+			case CTemplate::TOKEN_PERCENT:
+				AppendPercent(Buffer, BufferIter, pLanguage, *((const float*) pVarArgValue));
+				break;
+			case CTemplate::TOKEN_SEC:
 			{
-				//Flush the content of pText in the buffer
-				BufferIter = Buffer.append_at_num(BufferIter, pText+Start, Iter-Start);
-				Iter++;
-				ParamTypeStart = Iter;
+				int Duration = *((const int*) pVarArgValue);
+				int Minutes = Duration / 60;
+				int Seconds = Duration - Minutes*60;
+				if(Minutes > 0)
+				{
+					AppendDuration(Buffer, BufferIter, pLanguage, Minutes, icu::TimeUnit::UTIMEUNIT_MINUTE);
+					if(Seconds > 0)
+					{
+						BufferIter = Buffer.append_at(BufferIter, ", ");
+						AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
+					}
+				}
+				else
+					AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
+				break;
 			}
 		}
-		
-		Iter = str_utf8_forward(pText, Iter);
 	}
+	va_end(VarArgsIter);
 	
-	if(Iter > 0 && ParamTypeStart == -1 && ParamNameStart == -1)
+	if(pLanguage->GetWritingDirection() == DIRECTION_RTL)
+		ArabicShaping(Buffer, BufferStart);
+}
+
+void CLocalization::Format_V(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
+{
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
+	if(!pLanguage)
 	{
-		BufferIter = Buffer.append_at_num(BufferIter, pText+Start, Iter-Start);
+		Buffer.append(pText);
+		return;
 	}
 	
-	if(pLanguage && pLanguage->GetWritingDirection() == DIRECTION_RTL)
-		ArabicShaping(Buffer, BufferStart);
+	CTemplate* pUncached = NULL;
+	FormatTemplate(Buffer, pLanguage, SourceTemplate(pText, pUncached), VarArgs);
+	delete pUncached;
 }
 
 void CLocalization::Format(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...)
@@ -885,9 +1055,16 @@ void CLocalization::Format(dynamic_string& Buffer, const char* pLanguageCode, co
 
 void CLocalization::Format_VL(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, va_list VarArgs)
 {
-	const char* pLocalText = Localize(pLanguageCode, pText);
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
+	if(!pLanguage)
+	{
+		Buffer.append(pText);
+		return;
+	}
 	
-	Format_V(Buffer, pLanguageCode, pLocalText, VarArgs);
+	CTemplate* pUncached = NULL;
+	FormatTemplate(Buffer, pLanguage, LocalizeTemplateWithDepth(pLanguageCode, pText, 0, pUncached), VarArgs);
+	delete pUncached;
 }
 
 void CLocalization::Format_L(dynamic_string& Buffer, const char* pLanguageCode, const char* pText, ...)
@@ -902,9 +1079,16 @@ void CLocalization::Format_L(dynamic_string& Buffer, const char* pLanguageCode,
 
 void CLocalization::Format_VLP(dynamic_string& Buffer, const char* pLanguageCode, int Number, const char* pText, va_list VarArgs)
 {
-	const char* pLocalText = Localize_P(pLanguageCode, Number, pText);
+	CLanguage* pLanguage = FindLanguage(pLanguageCode);
+	if(!pLanguage)
+	{
+		Buffer.append(pText);
+		return;
+	}
 	
-	Format_V(Buffer, pLanguageCode, pLocalText, VarArgs);
+	CTemplate* pUncached = NULL;
+	FormatTemplate(Buffer, pLanguage, LocalizeTemplateWithDepth_P(pLanguageCode, Number, pText, 0, pUncached), VarArgs);
+	delete pUncached;
 }
 
 void CLocalization::Format_LP(dynamic_string& Buffer, const char* pLanguageCode, int Number, const char* pText, ...)
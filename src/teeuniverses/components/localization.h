@@ -58,6 +58,33 @@ public:
 	static const char *LanguageCodeByCountryCode(int country);
 	static const char *FallbackLanguageForIpCountryCode(int Country);
 
+	//a text split into literal spans and {type:name} arguments, so it's only parsed once
+	class CTemplate
+	{
+	public:
+		enum
+		{
+			TOKEN_TEXT=0,
+			TOKEN_STR,
+			TOKEN_INT,
+			TOKEN_PERCENT,
+			TOKEN_SEC,
+		};
+
+		struct CToken
+		{
+			int m_Type;
+			int m_Offset; //of the literal text or of the argument name
+			int m_Length;
+		};
+
+		char* m_pText;
+		array<CToken> m_Tokens;
+
+		CTemplate(const char* pText);
+		~CTemplate();
+	};
+
 	class CLanguage
 	{
 	protected:
@@ -65,20 +92,30 @@ public:
 		{
 		public:
 			char* m_apVersions[NUM_PLURALTYPES];
+			CTemplate* m_apTemplates[NUM_PLURALTYPES];
 			
 			CEntry()
 			{
 				for(int i=0; i<NUM_PLURALTYPES; i++)
+				{
 					m_apVersions[i] = NULL;
+					m_apTemplates[i] = NULL;
+				}
 			}
 			
 			void Free()
 			{
 				for(int i=0; i<NUM_PLURALTYPES; i++)
+				{
 					if(m_apVersions[i])
 						delete[] m_apVersions[i];
+					if(m_apTemplates[i])
+						delete m_apTemplates[i];
+				}
 			}
 		};
+
+		int PluralType(int Number) const;
 		
 	protected:
 		char m_aName[64];
@@ -109,6 +146,8 @@ public:
 		bool Load(CLocalization* pLocalization, class CStorage* pStorage);
 		const char* Localize(const char* pKey) const;
 		const char* Localize_P(int Number, const char* pText) const;
+		const CTemplate* LocalizeTemplate(const char* pKey) const;
+		const CTemplate* LocalizeTemplate_P(int Number, const char* pText) const;
 	};
 	
 	enum
@@ -119,12 +158,24 @@ public:
 	};
 
 protected:
+	enum
+	{
+		MAX_SOURCE_TEMPLATES=4096,
+		MAX_FORMAT_ARGS=32,
+	};
+
 	CLanguage* m_pMainLanguage;
 	array<IListener*> m_pListeners;
 	bool m_UpdateListeners;
 	
 	UConverter* m_pUtf8Converter;
 
+	//language code -> index in m_pLanguages
+	hashtable< int, 32 > m_LanguageIDs;
+	//templates of the untranslated texts
+	hashtable< CTemplate*, 512 > m_SourceTemplates;
+	int m_NumSourceTemplates;
+
 public:
 	array<CLanguage*> m_pLanguages;
 	fixed_string128 m_Cfg_MainLanguage;
@@ -132,6 +183,12 @@ public:
 protected:
 	const char* LocalizeWithDepth(const char* pLanguageCode, const char* pText, int Depth);
 	const char* LocalizeWithDepth_P(const char* pLanguageCode, int Number, const char* pText, int Depth);
+	const CTemplate* LocalizeTemplateWithDepth(const char* pLanguageCode, const char* pText, int Depth, CTemplate*& pUncached);
+	const CTemplate* LocalizeTemplateWithDepth_P(const char* pLanguageCode, int Number, const char* pText, int Depth, CTemplate*& pUncached);
+	//pUncached is set to a template the caller must delete when the cache is full
+	const CTemplate* SourceTemplate(const char* pText, CTemplate*& pUncached);
+	CLanguage* FindLanguage(const char* pLanguageCode);
+	void FormatTemplate(dynamic_string& Buffer, CLanguage* pLanguage, const CTemplate* pTemplate, va_list VarArgs);
 	
 	void AppendNumber(dynamic_string& Buffer, int& BufferIter, CLanguage* pLanguage, int Number);
 	void AppendPercent(dynamic_string& Buffer, int& BufferIter, CLanguage* pLanguage, double Number);
@@ -153,6 +210,9 @@ public:
 	void RemoveListener(IListener* pListener);
 	
 	inline bool GetWritingDirection() const { return (!m_pMainLanguage ? DIRECTION_LTR : m_pMainLanguage->GetWritingDirection()); }
+
+	//index of the language with this code, -1 if it's unknown (the main language is used then)
+	int GetLanguageID(const char* pLanguageCode) const;
 	
 	//localize
 	const char* Localize(const char* pLanguageCode, const char* pText);
@@ -0,0 +1,438 @@
+#include <gtest/gtest.h>
+
+#include <base/math.h>
+#include <base/system.h>
+#include <base/vmath.h>
+
+#include <engine/map.h>
+
+#include <game/animation.h>
+#include <game/collision.h>
+#include <game/gamecore.h>
+#include <game/layers.h>
+#include <game/mapitems.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+// The former pixel by pixel implementation of CCollision::IntersectLine()
+static int IntersectLineReference(const CCollision &Collision, vec2 Pos0, vec2 Pos1, vec2 *pOutCollision, vec2 *pOutBeforeCollision)
+{
+	vec2 Pos1Pos0 = Pos1 - Pos0;
+	float Distance = length(Pos1Pos0);
+	int End(Distance+1);
+	vec2 Last = Pos0;
+
+	for(int i = 0; i < End; i++)
+	{
+		float a = i/Distance;
+		vec2 Pos = Pos0 + Pos1Pos0 * a;
+		if(Collision.CheckPoint(Pos.x, Pos.y))
+		{
+			*pOutCollision = Pos;
+			*pOutBeforeCollision = Last;
+			return Collision.GetCollisionAt(Pos.x, Pos.y);
+		}
+		Last = Pos;
+	}
+	*pOutCollision = Pos1;
+	*pOutBeforeCollision = Pos1;
+	return 0;
+}
+
+TEST(Collision, IntersectLineMatchesPixelWalk)
+{
+	const int Width = 40;
+	const int Height = 30;
+	std::mt19937 Rng(1337);
+	std::uniform_int_distribution<int> TileDist(0, 99);
+	std::uniform_real_distribution<float> XDist(-100.0f, Width * 32 + 100.0f);
+	std::uniform_real_distribution<float> YDist(-100.0f, Height * 32 + 100.0f);
+	std::uniform_real_distribution<float> ShortDist(-40.0f, 40.0f);
+
+	std::vector<CTile> vTiles(Width * Height);
+	for(auto &Tile : vTiles)
+	{
+		const int Roll = TileDist(Rng);
+		Tile = {};
+		if(Roll < 8)
+			Tile.m_Index = TILE_SOLID;
+		else if(Roll < 12)
+			Tile.m_Index = TILE_NOHOOK;
+		else if(Roll < 14)
+			Tile.m_Index = TILE_DEATH;
+	}
+
+	CCollision Collision;
+	Collision.InitTiles(vTiles.data(), Width, Height);
+
+	for(int i = 0; i < 200000; i++)
+	{
+		vec2 Pos0(XDist(Rng), YDist(Rng));
+		vec2 Pos1;
+		switch(i % 4)
+		{
+		case 0: Pos1 = vec2(XDist(Rng), YDist(Rng)); break;
+		case 1: Pos1 = Pos0 + vec2(ShortDist(Rng), ShortDist(Rng)); break;
+		// axis aligned and tile aligned segments
+		case 2: Pos1 = vec2(Pos0.x, YDist(Rng)); break;
+		default:
+			Pos0 = vec2(round_to_int(Pos0.x / 32) * 32 - 0.5f, round_to_int(Pos0.y / 32) * 32);
+			Pos1 = Pos0 + vec2(32 * (i % 7), 32 * (i % 5));
+		}
+
+		vec2 ExpectedCollision, ExpectedBefore;
+		const int Expected = IntersectLineReference(Collision, Pos0, Pos1, &ExpectedCollision, &ExpectedBefore);
+		vec2 OutCollision, OutBefore;
+		const int Result = Collision.IntersectLine(Pos0, Pos1, &OutCollision, &OutBefore);
+
+		ASSERT_EQ(Result, Expected) << "from " << Pos0.x << ", " << Pos0.y << " to " << Pos1.x << ", " << Pos1.y;
+		ASSERT_EQ(OutCollision.x, ExpectedCollision.x);
+		ASSERT_EQ(OutCollision.y, ExpectedCollision.y);
+		ASSERT_EQ(OutBefore.x, ExpectedBefore.x);
+		ASSERT_EQ(OutBefore.y, ExpectedBefore.y);
+	}
+}
+
+// A map kept in memory, AddItem() must be called in the order of the item types
+class CTestMap : public IMap
+{
+	struct CItem
+	{
+		int m_Type;
+		std::vector<char> m_vData;
+	};
+	std::vector<CItem> m_vItems;
+	std::vector<std::vector<char>> m_vvData;
+
+public:
+	template<typename T>
+	void AddItem(int Type, const T &Item)
+	{
+		const char *pItem = reinterpret_cast<const char *>(&Item);
+		m_vItems.push_back({Type, std::vector<char>(pItem, pItem + sizeof(Item))});
+	}
+
+	template<typename T>
+	int AddData(const std::vector<T> &vData)
+	{
+		const char *pData = reinterpret_cast<const char *>(vData.data());
+		m_vvData.emplace_back(pData, pData + vData.size() * sizeof(T));
+		return m_vvData.size() - 1;
+	}
+
+	void *GetData(int Index) override { return m_vvData[Index].data(); }
+	int GetDataSize(int Index) const override { return m_vvData[Index].size(); }
+	void *GetDataSwapped(int Index) override { return GetData(Index); }
+	void UnloadData(int Index) override {}
+	int NumData() const override { return m_vvData.size(); }
+
+	void *GetItem(int Index, int *pType = nullptr, int *pID = nullptr) override
+	{
+		if(pType)
+			*pType = m_vItems[Index].m_Type;
+		if(pID)
+			*pID = 0;
+		return m_vItems[Index].m_vData.data();
+	}
+	int GetItemSize(int Index) override { return m_vItems[Index].m_vData.size(); }
+	void GetType(int Type, int *pStart, int *pNum) override
+	{
+		*pStart = 0;
+		*pNum = 0;
+		for(int i = 0; i < (int)m_vItems.size(); i++)
+		{
+			if(m_vItems[i].m_Type != Type)
+				continue;
+			if(!*pNum)
+				*pStart = i;
+			(*pNum)++;
+		}
+	}
+	void *FindItem(int Type, int ID) override { return nullptr; }
+	int NumItems() const override { return m_vItems.size(); }
+};
+
+// The quad test of the former zone lookup
+static vec3 BarycentricCoordinatesReference(const vec2 &t0, const vec2 &t1, const vec2 &t2, const vec2 &p)
+{
+	vec2 e0 = t1 - t0;
+	vec2 e1 = t2 - t0;
+	vec2 e2 = p - t0;
+
+	float d00 = dot(e0, e0);
+	float d01 = dot(e0, e1);
+	float d11 = dot(e1, e1);
+	float d20 = dot(e2, e0);
+	float d21 = dot(e2, e1);
+	float denom = d00 * d11 - d01 * d01;
+
+	vec3 bary;
+	bary.x = (d11 * d20 - d01 * d21) / denom;
+	bary.y = (d00 * d21 - d01 * d20) / denom;
+	bary.z = 1.0f - bary.x - bary.y;
+	return bary;
+}
+
+static bool InsideQuadReference(const vec2 *pPoints, vec2 p)
+{
+	for(int i = 0; i < 2; i++)
+	{
+		vec3 bary = BarycentricCoordinatesReference(pPoints[i], pPoints[i + 1], pPoints[i + 2], p);
+		if(bary.x >= 0.0f && bary.y >= 0.0f && bary.x + bary.y < 1.0f)
+			return true;
+	}
+	return false;
+}
+
+// The former implementation of CCollision::GetZoneValueAt(), it tested every tile layer and quad
+static int GetZoneValueReference(CLayers *pLayers, const char *pName, double Time, float x, float y, ZoneData *pData)
+{
+	int Index = 0;
+	int ExtraData = 0;
+	char aLayerName[12];
+
+	const CMapItemGroup *pGroup = pLayers->ZoneGroup();
+	for(int l = 0; l < pGroup->m_NumLayers; l++)
+	{
+		CMapItemLayer *pLayer = pLayers->GetLayer(pGroup->m_StartLayer + l);
+		if(pLayer->m_Type == LAYERTYPE_TILES)
+		{
+			CMapItemLayerTilemap *pTLayer = (CMapItemLayerTilemap *)pLayer;
+			IntsToStr(pTLayer->m_aName, sizeof(aLayerName) / sizeof(int), aLayerName);
+			if(str_comp(pName, aLayerName) != 0)
+				continue;
+
+			CTile *pTiles = (CTile *)pLayers->Map()->GetData(pTLayer->m_Data);
+			int Nx = clamp(round_to_int(x) / 32, 0, pTLayer->m_Width - 1);
+			int Ny = clamp(round_to_int(y) / 32, 0, pTLayer->m_Height - 1);
+			int TileIndex = (pTiles[Ny * pTLayer->m_Width + Nx].m_Index > 128 ? 0 : pTiles[Ny * pTLayer->m_Width + Nx].m_Index);
+			if(TileIndex > 0)
+				Index = TileIndex;
+		}
+		else if(pLayer->m_Type == LAYERTYPE_QUADS)
+		{
+			CMapItemLayerQuads *pQLayer = (CMapItemLayerQuads *)pLayer;
+			IntsToStr(pQLayer->m_aName, sizeof(aLayerName) / sizeof(int), aLayerName);
+			if(str_comp(pName, aLayerName) != 0)
+				continue;
+
+			const CQuad *pQuads = (const CQuad *)pLayers->Map()->GetDataSwapped(pQLayer->m_Data);
+			for(int q = 0; q < pQLayer->m_NumQuads; q++)
+			{
+				vec2 Position(0.0f, 0.0f);
+				float Angle = 0.0f;
+				if(pQuads[q].m_PosEnv >= 0)
+					GetAnimationTransform(Time, pQuads[q].m_PosEnv, pLayers, Position, Angle);
+
+				vec2 aPoints[4];
+				for(int i = 0; i < 4; i++)
+					aPoints[i] = Position + vec2(fx2f(pQuads[q].m_aPoints[i].x), fx2f(pQuads[q].m_aPoints[i].y));
+				if(Angle != 0)
+				{
+					vec2 Center(fx2f(pQuads[q].m_aPoints[4].x), fx2f(pQuads[q].m_aPoints[4].y));
+					for(vec2 &Point : aPoints)
+					{
+						const vec2 Rel = Point - Center;
+						Point.x = Rel.x * cosf(Angle) - Rel.y * sinf(Angle) + Center.x;
+						Point.y = Rel.x * sinf(Angle) + Rel.y * cosf(Angle) + Center.y;
+					}
+				}
+
+				const float MinX = minimum(minimum(aPoints[0].x, aPoints[1].x), minimum(aPoints[2].x, aPoints[3].x));
+				const float MaxX = maximum(maximum(aPoints[0].x, aPoints[1].x), maximum(aPoints[2].x, aPoints[3].x));
+				const float MinY = minimum(minimum(aPoints[0].y, aPoints[1].y), minimum(aPoints[2].y, aPoints[3].y));
+				const float MaxY = maximum(maximum(aPoints[0].y, aPoints[1].y), maximum(aPoints[2].y, aPoints[3].y));
+				if(x < MinX || x > MaxX || y < MinY || y > MaxY)
+					continue;
+
+				if(InsideQuadReference(aPoints, vec2(x, y)))
+				{
+					Index = pQuads[q].m_ColorEnvOffset;
+					ExtraData = pQuads[q].m_aColors[0].g;
+				}
+			}
+		}
+	}
+
+	pData->Index = Index;
+	pData->ExtraData = ExtraData;
+	return Index;
+}
+
+static CMapItemLayerTilemap TileLayer(int Width, int Height, int Flags, int Data, const char *pName)
+{
+	CMapItemLayerTilemap Layer = {};
+	Layer.m_Layer.m_Type = LAYERTYPE_TILES;
+	Layer.m_Version = 3;
+	Layer.m_Width = Width;
+	Layer.m_Height = Height;
+	Layer.m_Flags = Flags;
+	Layer.m_Data = Data;
+	Layer.m_Image = -1;
+	Layer.m_Tele = -1;
+	Layer.m_Speedup = -1;
+	StrToInts(Layer.m_aName, std::size(Layer.m_aName), pName);
+	return Layer;
+}
+
+static CMapItemLayerQuads QuadLayer(int NumQuads, int Data, const char *pName)
+{
+	CMapItemLayerQuads Layer = {};
+	Layer.m_Layer.m_Type = LAYERTYPE_QUADS;
+	Layer.m_Version = 2;
+	Layer.m_NumQuads = NumQuads;
+	Layer.m_Data = Data;
+	Layer.m_Image = -1;
+	StrToInts(Layer.m_aName, std::size(Layer.m_aName), pName);
+	return Layer;
+}
+
+static CMapItemGroup Group(int StartLayer, int NumLayers, const char *pName)
+{
+	CMapItemGroup Group = {};
+	Group.m_Version = CMapItemGroup::CURRENT_VERSION;
+	Group.m_ParallaxX = 100;
+	Group.m_ParallaxY = 100;
+	Group.m_StartLayer = StartLayer;
+	Group.m_NumLayers = NumLayers;
+	StrToInts(Group.m_aName, std::size(Group.m_aName), pName);
+	return Group;
+}
+
+TEST(Collision, ZoneCacheMatchesLayerWalk)
+{
+	const int Width = 30;
+	const int Height = 20;
+	std::mt19937 Rng(4242);
+	std::uniform_int_distribution<int> TileDist(0, 99);
+	std::uniform_real_distribution<float> XDist(-100.0f, Width * 32 + 100.0f);
+	std::uniform_real_distribution<float> YDist(-100.0f, Height * 32 + 100.0f);
+	std::uniform_real_distribution<float> SizeDist(4.0f, 200.0f);
+	std::uniform_real_distribution<float> AngleDist(0.0f, 2.0f * pi);
+
+	auto RandomTiles = [&](int W, int H) {
+		std::vector<CTile> vTiles(W * H);
+		for(auto &Tile : vTiles)
+		{
+			const int Roll = TileDist(Rng);
+			Tile = {};
+			// the indices above 128 are ignored by the zones
+			Tile.m_Index = Roll < 70 ? 0 : Roll < 95 ? 1 + Roll % 5 : 129 + Roll % 3;
+		}
+		return vTiles;
+	};
+
+	auto RandomQuads = [&](int Num, int NumEnvelopes) {
+		std::vector<CQuad> vQuads(Num);
+		for(int q = 0; q < Num; q++)
+		{
+			CQuad &Quad = vQuads[q];
+			Quad = {};
+			const vec2 Center(XDist(Rng), YDist(Rng));
+			const vec2 HalfSize(SizeDist(Rng), SizeDist(Rng));
+			// a third of the quads are tile aligned rectangles, the others are rotated
+			const float Angle = q % 3 == 0 ? 0.0f : AngleDist(Rng);
+			const vec2 aCorners[4] = {vec2(-1, -1), vec2(1, -1), vec2(-1, 1), vec2(1, 1)};
+			for(int i = 0; i < 4; i++)
+			{
+				vec2 Corner = aCorners[i] * HalfSize;
+				Corner = vec2(Corner.x * cosf(Angle) - Corner.y * sinf(Angle), Corner.x * sinf(Angle) + Corner.y * cosf(Angle));
+				if(q % 3 == 0)
+					Corner = vec2(round_to_int((Center.x + Corner.x) / 32) * 32, round_to_int((Center.y + Corner.y) / 32) * 32) - Center;
+				Quad.m_aPoints[i].x = f2fx(Center.x + Corner.x);
+				Quad.m_aPoints[i].y = f2fx(Center.y + Corner.y);
+			}
+			Quad.m_aPoints[4].x = f2fx(Center.x);
+			Quad.m_aPoints[4].y = f2fx(Center.y);
+			Quad.m_aColors[0].g = TileDist(Rng);
+			Quad.m_ColorEnvOffset = 1 + TileDist(Rng) % 7;
+			Quad.m_ColorEnv = -1;
+			Quad.m_PosEnv = q % 4 == 1 ? q % NumEnvelopes : -1;
+		}
+		return vQuads;
+	};
+
+	CTestMap Map;
+	std::vector<CTile> vGameTiles(Width * Height);
+	const int GameData = Map.AddData(vGameTiles);
+	const int TileData = Map.AddData(RandomTiles(Width, Height));
+	const int SmallTileData = Map.AddData(RandomTiles(Width - 7, Height + 4));
+	const int OtherTileData = Map.AddData(RandomTiles(Width, Height));
+	const std::vector<CQuad> vQuads = RandomQuads(60, 2);
+	const int QuadData = Map.AddData(vQuads);
+	const std::vector<CQuad> vMoreQuads = RandomQuads(40, 2);
+	const int MoreQuadData = Map.AddData(vMoreQuads);
+
+	// a moving and rotating envelope, and a fixed one
+	CMapItemEnvelope aEnvelopes[2] = {};
+	aEnvelopes[0].m_Version = CMapItemEnvelope::CURRENT_VERSION;
+	aEnvelopes[0].m_Channels = 3;
+	aEnvelopes[0].m_StartPoint = 0;
+	aEnvelopes[0].m_NumPoints = 3;
+	aEnvelopes[1] = aEnvelopes[0];
+	aEnvelopes[1].m_StartPoint = 3;
+	aEnvelopes[1].m_NumPoints = 1;
+	CEnvPoint aEnvPoints[4] = {
+		{0, CURVETYPE_LINEAR, {f2fx(0.0f), f2fx(0.0f), f2fx(0.0f), 0}},
+		{1000, CURVETYPE_SMOOTH, {f2fx(150.0f), f2fx(-40.0f), f2fx(90.0f), 0}},
+		{2500, CURVETYPE_LINEAR, {f2fx(-60.0f), f2fx(90.0f), f2fx(-30.0f), 0}},
+		{0, CURVETYPE_LINEAR, {f2fx(37.0f), f2fx(-21.0f), f2fx(45.0f), 0}},
+	};
+
+	Map.AddItem(MAPITEMTYPE_ENVELOPE, aEnvelopes[0]);
+	Map.AddItem(MAPITEMTYPE_ENVELOPE, aEnvelopes[1]);
+	Map.AddItem(MAPITEMTYPE_GROUP, Group(0, 1, "Game"));
+	Map.AddItem(MAPITEMTYPE_GROUP, Group(1, 5, "#Zones"));
+	Map.AddItem(MAPITEMTYPE_LAYER, TileLayer(Width, Height, TILESLAYERFLAG_GAME, GameData, "Game"));
+	Map.AddItem(MAPITEMTYPE_LAYER, TileLayer(Width, Height, 0, TileData, "damage"));
+	Map.AddItem(MAPITEMTYPE_LAYER, QuadLayer(vQuads.size(), QuadData, "damage"));
+	Map.AddItem(MAPITEMTYPE_LAYER, TileLayer(Width, Height, 0, OtherTileData, "teleport"));
+	Map.AddItem(MAPITEMTYPE_LAYER, TileLayer(Width - 7, Height + 4, 0, SmallTileData, "damage"));
+	Map.AddItem(MAPITEMTYPE_LAYER, QuadLayer(vMoreQuads.size(), MoreQuadData, "damage"));
+	for(const CEnvPoint &Point : aEnvPoints)
+		Map.AddItem(MAPITEMTYPE_ENVPOINTS, Point);
+
+	CLayers Layers;
+	Layers.Init(&Map);
+	CCollision Collision;
+	Collision.Init(&Layers);
+	const char *apNames[] = {"damage", "teleport"};
+	int aHandles[std::size(apNames)];
+	for(int i = 0; i < (int)std::size(apNames); i++)
+		aHandles[i] = Collision.GetZoneHandle(apNames[i]);
+
+	for(int i = 0; i < 100000; i++)
+	{
+		const double Time = (i / 1000) * 0.137;
+		Collision.SetTime(Time);
+
+		vec2 Pos(XDist(Rng), YDist(Rng));
+		// the borders of the cells
+		if(i % 3 == 0)
+			Pos = vec2(round_to_int(Pos.x / 32) * 32 + (i % 5 - 2) * 0.25f, Pos.y);
+		if(i % 5 == 0)
+			Pos = vec2(Pos.x, round_to_int(Pos.y / 32) * 32 + (i % 3 - 1) * 0.5f);
+
+		for(int h = 0; h < (int)std::size(apNames); h++)
+		{
+			ZoneData Expected, Data;
+			const int ExpectedIndex = GetZoneValueReference(&Layers, apNames[h], Time, Pos.x, Pos.y, &Expected);
+			const int Index = Collision.GetZoneValueAt(aHandles[h], Pos.x, Pos.y, &Data);
+
+			ASSERT_EQ(Index, ExpectedIndex) << apNames[h] << " at " << Pos.x << ", " << Pos.y << " time " << Time;
+			ASSERT_EQ(Data.Index, Expected.Index);
+			ASSERT_EQ(Data.ExtraData, Expected.ExtraData) << apNames[h] << " at " << Pos.x << ", " << Pos.y << " time " << Time;
+		}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+
+	int Result = RUN_ALL_TESTS();
+
+	return Result;
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+
+#include <engine/engine.h>
+#include <engine/shared/datafile.h>
+#include <engine/storage.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+// Random items and datas, the datas mix runs of a few bytes, which compress well, with noise
+static void WriteRandomDataFile(IStorage *pStorage, IEngine *pEngine, const char *pFilename, unsigned Seed, std::vector<std::vector<unsigned char>> *pvvDatas)
+{
+	std::mt19937 Rng(Seed);
+	std::uniform_int_distribution<int> SizeDist(0, 64 * 1024);
+	std::uniform_int_distribution<int> ByteDist(0, 255);
+	std::uniform_int_distribution<int> LevelDist(Z_DEFAULT_COMPRESSION, Z_BEST_COMPRESSION);
+
+	CDataFileWriter Writer;
+	Writer.SetParallelCompression(pEngine);
+	ASSERT_TRUE(Writer.Open(pStorage, pFilename));
+
+	pvvDatas->clear();
+	for(int i = 0; i < 200; i++)
+	{
+		std::vector<unsigned char> vData(SizeDist(Rng));
+		const int Noise = ByteDist(Rng);
+		for(unsigned char &Byte : vData)
+			Byte = ByteDist(Rng) < Noise ? ByteDist(Rng) : i;
+
+		if(i % 4 == 0)
+			Writer.AddData(vData.size(), vData.data(), LevelDist(Rng));
+		else
+			Writer.AddData(vData.size(), vData.data());
+		pvvDatas->push_back(std::move(vData));
+
+		int aItem[8];
+		for(int &Value : aItem)
+			Value = Rng();
+		Writer.AddItem(i % 7, i, sizeof(int) * (1 + i % 8), aItem);
+	}
+	ASSERT_EQ(Writer.Finish(), 0);
+}
+
+class CTempFiles
+{
+	IStorage *m_pStorage;
+
+public:
+	char m_aSerial[IO_MAX_PATH_LENGTH];
+	char m_aParallel[IO_MAX_PATH_LENGTH];
+
+	CTempFiles(IStorage *pStorage) :
+		m_pStorage(pStorage)
+	{
+		str_format(m_aSerial, sizeof(m_aSerial), "test_datafile_%d_serial.map", pid());
+		str_format(m_aParallel, sizeof(m_aParallel), "test_datafile_%d_parallel.map", pid());
+	}
+	~CTempFiles()
+	{
+		m_pStorage->RemoveFile(m_aSerial, IStorage::TYPE_SAVE);
+		m_pStorage->RemoveFile(m_aParallel, IStorage::TYPE_SAVE);
+	}
+};
+
+TEST(Datafile, ParallelCompressionMatchesSerial)
+{
+	std::unique_ptr<IEngine> pEngine(CreateTestEngine("test_datafile", 4));
+	std::unique_ptr<IStorage> pStorage(CreateLocalStorage());
+	ASSERT_TRUE(pStorage);
+
+	CTempFiles Files(pStorage.get());
+	const char *pSerialFilename = Files.m_aSerial;
+	const char *pParallelFilename = Files.m_aParallel;
+
+	std::vector<std::vector<unsigned char>> vvDatas;
+	WriteRandomDataFile(pStorage.get(), nullptr, pSerialFilename, 1337, &vvDatas);
+	WriteRandomDataFile(pStorage.get(), pEngine.get(), pParallelFilename, 1337, &vvDatas);
+
+	void *pSerial = nullptr;
+	void *pParallel = nullptr;
+	unsigned SerialSize = 0;
+	unsigned ParallelSize = 0;
+	ASSERT_TRUE(pStorage->ReadFile(pSerialFilename, IStorage::TYPE_SAVE, &pSerial, &SerialSize));
+	ASSERT_TRUE(pStorage->ReadFile(pParallelFilename, IStorage::TYPE_SAVE, &pParallel, &ParallelSize));
+	ASSERT_EQ(SerialSize, ParallelSize);
+	EXPECT_EQ(mem_comp(pSerial, pParallel, SerialSize), 0);
+	free(pSerial);
+	free(pParallel);
+
+	CDataFileReader Reader;
+	ASSERT_TRUE(Reader.Open(pStorage.get(), pParallelFilename, IStorage::TYPE_SAVE));
+	ASSERT_EQ(Reader.NumData(), (int)vvDatas.size());
+	for(int i = 0; i < Reader.NumData(); i++)
+	{
+		ASSERT_EQ(Reader.GetDataSize(i), (int)vvDatas[i].size());
+		const void *pData = Reader.GetData(i);
+		ASSERT_TRUE(pData || vvDatas[i].empty());
+		if(!vvDatas[i].empty())
+			EXPECT_EQ(mem_comp(pData, vvDatas[i].data(), vvDatas[i].size()), 0) << "data " << i;
+	}
+	Reader.Close();
+
+	pEngine->ShutdownJobs();
+}
+
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+
+	int Result = RUN_ALL_TESTS();
+
+	return Result;
+}
@@ -0,0 +1,374 @@
+#include <gtest/gtest.h>
+
+#include <base/system.h>
+
+#include <engine/storage.h>
+#include <teeuniverses/components/localization.h>
+
+#include <memory>
+
+static const char s_aIndex[] = R"json({"language indices": [
+	{"name": "English", "file": "en", "parent": ""},
+	{"name": "Russian", "file": "ru", "parent": "en"},
+	{"name": "Arabic", "file": "ar", "parent": "en", "direction": "rtl"}
+]})json";
+
+static const char s_aEnglish[] = R"json({"translation": [
+	{"key": "{str:Name} has {int:Num} points", "value": "{str:Name} now has {int:Num} points"},
+	{"key": "{int:Num} kills", "one": "{int:Num} kill by {str:Name}", "other": "{int:Num} kills by {str:Name}"}
+]})json";
+
+static const char s_aRussian[] = R"json({"translation": [
+	{"key": "{str:Name} has {int:Num} points", "value": "У {str:Name} {int:Num} очков"},
+	{"key": "{int:Num} kills", "one": "{int:Num} убийство ({str:Name})", "few": "{int:Num} убийства ({str:Name})", "many": "{int:Num} убийств ({str:Name})", "other": "{int:Num} убийства, {str:Name}"}
+]})json";
+
+static const char s_aArabic[] = R"json({"translation": [
+	{"key": "{str:Name} has {int:Num} points", "value": "{str:Name} لديه {int:Num} نقاط"}
+]})json";
+
+// The formatter the templates replaced, it parsed the text and looked the arguments up on every call
+class CTestLocalization : public CLocalization
+{
+	void FormatReference_V(dynamic_string &Buffer, const char *pLanguageCode, const char *pText, va_list VarArgs)
+	{
+		CLanguage *pLanguage = m_pMainLanguage;
+		if(pLanguageCode)
+		{
+			for(int i = 0; i < m_pLanguages.size(); i++)
+			{
+				if(str_comp(m_pLanguages[i]->GetFilename(), pLanguageCode) == 0)
+				{
+					pLanguage = m_pLanguages[i];
+					break;
+				}
+			}
+		}
+		if(!pLanguage)
+		{
+			Buffer.append(pText);
+			return;
+		}
+
+		const char *pVarArgName = NULL;
+		const void *pVarArgValue = NULL;
+
+		int Iter = 0;
+		int Start = Iter;
+		int ParamTypeStart = -1;
+		int ParamNameStart = -1;
+		int ParamNameLength = 0;
+
+		int BufferStart = Buffer.length();
+		int BufferIter = BufferStart;
+
+		while(pText[Iter])
+		{
+			if(ParamNameStart >= 0)
+			{
+				if(pText[Iter] == '}')
+				{
+					va_list VarArgsIter;
+					va_copy(VarArgsIter, VarArgs);
+					pVarArgName = va_arg(VarArgsIter, const char *);
+					while(pVarArgName)
+					{
+						pVarArgValue = va_arg(VarArgsIter, const void *);
+						if(str_comp_num(pText + ParamNameStart, pVarArgName, ParamNameLength) == 0)
+						{
+							if(str_comp_num("str:", pText + ParamTypeStart, 4) == 0)
+							{
+								BufferIter = Buffer.append_at(BufferIter, (const char *)pVarArgValue);
+							}
+							else if(str_comp_num("int:", pText + ParamTypeStart, 4) == 0)
+							{
+								AppendNumber(Buffer, BufferIter, pLanguage, *((const int *)pVarArgValue));
+							}
+							else if(str_comp_num("percent:", pText + ParamTypeStart, 4) == 0)
+							{
+								AppendPercent(Buffer, BufferIter, pLanguage, *((const float *)pVarArgValue));
+							}
+							else if(str_comp_num("sec:", pText + ParamTypeStart, 4) == 0)
+							{
+								int Duration = *((const int *)pVarArgValue);
+								int Minutes = Duration / 60;
+								int Seconds = Duration - Minutes * 60;
+								if(Minutes > 0)
+								{
+									AppendDuration(Buffer, BufferIter, pLanguage, Minutes, icu::TimeUnit::UTIMEUNIT_MINUTE);
+									if(Seconds > 0)
+									{
+										BufferIter = Buffer.append_at(BufferIter, ", ");
+										AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
+									}
+								}
+								else
+									AppendDuration(Buffer, BufferIter, pLanguage, Seconds, icu::TimeUnit::UTIMEUNIT_SECOND);
+							}
+							break;
+						}
+
+						pVarArgName = va_arg(VarArgsIter, const char *);
+					}
+					va_end(VarArgsIter);
+
+					Start = Iter + 1;
+					ParamTypeStart = -1;
+					ParamNameStart = -1;
+				}
+				else
+					ParamNameLength++;
+			}
+			else if(ParamTypeStart >= 0)
+			{
+				if(pText[Iter] == ':')
+				{
+					ParamNameStart = Iter + 1;
+					ParamNameLength = 0;
+				}
+				else if(pText[Iter] == '}')
+				{
+					Start = Iter + 1;
+					ParamTypeStart = -1;
+					ParamNameStart = -1;
+				}
+			}
+			else
+			{
+				if(pText[Iter] == '{')
+				{
+					BufferIter = Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
+					Iter++;
+					ParamTypeStart = Iter;
+				}
+			}
+
+			Iter = str_utf8_forward(pText, Iter);
+		}
+
+		if(Iter > 0 && ParamTypeStart == -1 && ParamNameStart == -1)
+		{
+			BufferIter = Buffer.append_at_num(BufferIter, pText + Start, Iter - Start);
+		}
+
+		if(pLanguage->GetWritingDirection() == DIRECTION_RTL)
+			ArabicShaping(Buffer, BufferStart);
+	}
+
+public:
+	CTestLocalization(IStorage *pStorage) :
+		CLocalization(pStorage)
+	{
+	}
+
+	void FormatReference(dynamic_string &Buffer, const char *pLanguageCode, const char *pText, ...)
+	{
+		va_list VarArgs;
+		va_start(VarArgs, pText);
+		FormatReference_V(Buffer, pLanguageCode, pText, VarArgs);
+		va_end(VarArgs);
+	}
+};
+
+class CTempLanguages
+{
+	char m_aDir[IO_MAX_PATH_LENGTH];
+	char m_aLanguagesDir[IO_MAX_PATH_LENGTH];
+
+	void Path(char *pBuf, int BufSize, const char *pFile) const
+	{
+		str_format(pBuf, BufSize, "%s/%s", m_aLanguagesDir, pFile);
+	}
+
+public:
+	CTempLanguages()
+	{
+		str_format(m_aDir, sizeof(m_aDir), "test_localization_%d", pid());
+		str_format(m_aLanguagesDir, sizeof(m_aLanguagesDir), "%s/languages", m_aDir);
+		fs_makedir(m_aDir);
+		fs_makedir(m_aLanguagesDir);
+	}
+	~CTempLanguages()
+	{
+		char aPath[IO_MAX_PATH_LENGTH];
+		for(const char *pFile : {"index.json", "en.json", "ru.json", "ar.json"})
+		{
+			Path(aPath, sizeof(aPath), pFile);
+			fs_remove(aPath);
+		}
+		fs_removedir(m_aLanguagesDir);
+		fs_removedir(m_aDir);
+	}
+
+	const char *Dir() const { return m_aDir; }
+
+	bool Write(const char *pFile, const char *pContent) const
+	{
+		char aPath[IO_MAX_PATH_LENGTH];
+		Path(aPath, sizeof(aPath), pFile);
+		IOHANDLE File = io_open(aPath, IOFLAG_WRITE);
+		if(!File)
+			return false;
+		io_write(File, pContent, str_length(pContent));
+		io_close(File);
+		return true;
+	}
+};
+
+class Localization : public ::testing::Test
+{
+protected:
+	CTempLanguages m_Languages;
+	std::unique_ptr<IStorage> m_pStorage;
+	std::unique_ptr<CTestLocalization> m_pLocalization;
+
+	void SetUp() override
+	{
+		ASSERT_TRUE(m_Languages.Write("index.json", s_aIndex));
+		ASSERT_TRUE(m_Languages.Write("en.json", s_aEnglish));
+		ASSERT_TRUE(m_Languages.Write("ru.json", s_aRussian));
+		ASSERT_TRUE(m_Languages.Write("ar.json", s_aArabic));
+
+		m_pStorage.reset(CreateTempStorage(m_Languages.Dir()));
+		ASSERT_TRUE(m_pStorage);
+		m_pLocalization = std::make_unique<CTestLocalization>(m_pStorage.get());
+		ASSERT_TRUE(m_pLocalization->InitConfig(0, NULL));
+		ASSERT_TRUE(m_pLocalization->Init());
+		ASSERT_EQ(m_pLocalization->m_pLanguages.size(), 3);
+	}
+
+	// the arguments are passed as given, the NULL terminator is added here
+	template<typename... TArgs>
+	void ExpectFormat(const char *pLanguageCode, const char *pText, TArgs... Args)
+	{
+		dynamic_string Buffer;
+		dynamic_string Expected;
+		m_pLocalization->Format(Buffer, pLanguageCode, pText, Args..., (const char *)NULL);
+		m_pLocalization->FormatReference(Expected, pLanguageCode, pText, Args..., (const char *)NULL);
+		EXPECT_STREQ(Buffer.buffer(), Expected.buffer()) << "'" << pText << "' in " << (pLanguageCode ? pLanguageCode : "(null)");
+	}
+
+	template<typename... TArgs>
+	void ExpectFormatL(const char *pLanguageCode, const char *pText, TArgs... Args)
+	{
+		dynamic_string Buffer;
+		dynamic_string Expected;
+		m_pLocalization->Format_L(Buffer, pLanguageCode, pText, Args..., (const char *)NULL);
+		m_pLocalization->FormatReference(Expected, pLanguageCode, m_pLocalization->Localize(pLanguageCode, pText), Args..., (const char *)NULL);
+		EXPECT_STREQ(Buffer.buffer(), Expected.buffer()) << "'" << pText << "' in " << pLanguageCode;
+	}
+
+	template<typename... TArgs>
+	void ExpectFormatLP(const char *pLanguageCode, int Number, const char *pText, TArgs... Args)
+	{
+		dynamic_string Buffer;
+		dynamic_string Expected;
+		m_pLocalization->Format_LP(Buffer, pLanguageCode, Number, pText, Args..., (const char *)NULL);
+		m_pLocalization->FormatReference(Expected, pLanguageCode, m_pLocalization->Localize_P(pLanguageCode, Number, pText), Args..., (const char *)NULL);
+		EXPECT_STREQ(Buffer.buffer(), Expected.buffer()) << "'" << pText << "' for " << Number << " in " << pLanguageCode;
+	}
+};
+
+static const char *const s_apCodes[] = {"en", "ru", "ar", "xx", nullptr};
+
+TEST_F(Localization, FormatArguments)
+{
+	const int Num = 12345;
+	const int Negative = -7;
+	const float Ratio = 0.25f;
+	for(const char *pCode : s_apCodes)
+	{
+		ExpectFormat(pCode, "");
+		ExpectFormat(pCode, "no arguments at all");
+		ExpectFormat(pCode, "{str:Name} has {int:Num} points", "Name", "bob", "Num", &Num);
+		ExpectFormat(pCode, "{str:Name} has {int:Num} points", "Num", &Num, "Name", "bob");
+		ExpectFormat(pCode, "{int:Num}{str:Name}{int:Num}{str:Name}", "Name", "bob", "Num", &Negative);
+		ExpectFormat(pCode, "héllo {str:Name}, ça va ?", "Name", "wörld");
+		ExpectFormat(pCode, "{percent:Ratio} done, {perc:Ratio} too", "Ratio", &Ratio);
+		for(int Duration : {0, 1, 59, 60, 61, 3605})
+			ExpectFormat(pCode, "{sec:Time} left", "Time", &Duration);
+		// the second call takes the cached template
+		ExpectFormat(pCode, "{str:Name} has {int:Num} points", "Name", "alice", "Num", &Negative);
+	}
+}
+
+TEST_F(Localization, FormatPrefixMatching)
+{
+	const int Num = 3;
+	for(const char *pCode : s_apCodes)
+	{
+		// a name matches every argument it is a prefix of, the first one wins
+		ExpectFormat(pCode, "[{str:Player}]", "PlayerName", "bob");
+		ExpectFormat(pCode, "[{str:Player}]", "PlayerA", "bob", "PlayerB", "alice");
+		ExpectFormat(pCode, "[{str:PlayerName}]", "Player", "bob");
+		ExpectFormat(pCode, "[{str:}]", "Name", "bob");
+		ExpectFormat(pCode, "[{str:Name}{int:Name}]", "Nam", "bob", "NameNum", &Num);
+		ExpectFormat(pCode, "[{str:B}] [{str:A}] [{str:B}]", "A", "a", "B", "b");
+	}
+}
+
+TEST_F(Localization, FormatUnknownArguments)
+{
+	const int Num = 3;
+	for(const char *pCode : s_apCodes)
+	{
+		ExpectFormat(pCode, "[{str:Missing}]");
+		ExpectFormat(pCode, "[{str:Missing}] [{str:Name}]", "Name", "bob");
+		ExpectFormat(pCode, "[{str:Name}] [{int:Missing}]", "Name", "bob", "Num", &Num);
+		ExpectFormat(pCode, "[{abc:Name}] [{Name}] [{}] [{:Name}]", "Name", "bob");
+		ExpectFormat(pCode, "[{inte:Num}] [{st:Name}] [{string:Name}]", "Name", "bob", "Num", &Num);
+		ExpectFormat(pCode, "unterminated {str:Name", "Name", "bob");
+		ExpectFormat(pCode, "unterminated {str", "Name", "bob");
+		ExpectFormat(pCode, "} stray {str:Name}} braces }", "Name", "bob");
+	}
+}
+
+TEST_F(Localization, FormatTranslated)
+{
+	const int Num = 42;
+	for(const char *pCode : s_apCodes)
+	{
+		ExpectFormatL(pCode, "{str:Name} has {int:Num} points", "Name", "bob", "Num", &Num);
+		ExpectFormatL(pCode, "{str:Name} has {int:Num} points", "Num", &Num);
+		ExpectFormatL(pCode, "not translated {str:Name}", "Name", "bob");
+	}
+
+	dynamic_string Buffer;
+	m_pLocalization->Format_L(Buffer, "en", "{str:Name} has {int:Num} points", "Name", "bob", "Num", &Num, NULL);
+	EXPECT_STREQ(Buffer.buffer(), "bob now has 42 points");
+}
+
+TEST_F(Localization, FormatPlural)
+{
+	for(const char *pCode : s_apCodes)
+	{
+		for(int Num : {0, 1, 2, 3, 5, 11, 21, 22, 25, 101, 1000})
+		{
+			ExpectFormatLP(pCode, Num, "{int:Num} kills", "Num", &Num, "Name", "bob");
+			ExpectFormatLP(pCode, Num, "{int:Num} kills", "Name", "bob");
+			ExpectFormatLP(pCode, Num, "{int:Num} deaths", "Num", &Num);
+		}
+	}
+
+	const int One = 1;
+	const int Few = 3;
+	const int Many = 5;
+	dynamic_string Buffer;
+	m_pLocalization->Format_LP(Buffer, "en", One, "{int:Num} kills", "Num", &One, "Name", "bob", NULL);
+	EXPECT_STREQ(Buffer.buffer(), "1 kill by bob");
+	Buffer.clear();
+	m_pLocalization->Format_LP(Buffer, "ru", Few, "{int:Num} kills", "Num", &Few, "Name", "bob", NULL);
+	EXPECT_STREQ(Buffer.buffer(), "3 убийства (bob)");
+	Buffer.clear();
+	m_pLocalization->Format_LP(Buffer, "ru", Many, "{int:Num} kills", "Num", &Many, "Name", "bob", NULL);
+	EXPECT_STREQ(Buffer.buffer(), "5 убийств (bob)");
+}
+
+int main(int argc, char *argv[])
+{
+	::testing::InitGoogleTest(&argc, const_cast<char **>(argv));
+
+	int Result = RUN_ALL_TESTS();
+
+	return Result;
+}
@@ -0,0 +1,286 @@
+#include <base/logger.h>
+#include <base/math.h>
+#include <base/system.h>
+
+#include <engine/console.h>
+#include <engine/engine.h>
+#include <engine/map.h>
+#include <engine/server/server.h>
+#include <engine/shared/config.h>
+#include <engine/shared/inputtrace.h>
+#include <engine/storage.h>
+
+#include <game/generated/protocol.h>
+#include <game/server/infclass/infcgamecontroller.h>
+#include <game/version.h>
+
+#include <teeuniverses/components/localization.h>
+
+#include <random>
+#include <thread>
+
+// Runs the server without sockets, with all the slots filled by bots playing
+// every class, and reports the tick rate, the tick phase timings and the
+// snapshot sizes. The bots and the game use the same seed so that two runs
+// of the same build simulate the same game.
+//
+// With -r, the game of an input trace recorded with sv_input_trace is
+// replayed instead, on the map and with the seed of the trace.
+
+static const char *TOOL_NAME = "bench_server";
+
+class CBenchBot
+{
+	std::mt19937 m_Random;
+	CNetObj_PlayerInput m_Input;
+	float m_Angle;
+	int m_NextMove;
+
+	int Range(int Min, int Max) { return std::uniform_int_distribution<int>(Min, Max)(m_Random); }
+	bool Chance(int Percent) { return Range(0, 99) < Percent; }
+
+public:
+	CBenchBot(unsigned Seed) :
+		m_Random(Seed)
+	{
+		mem_zero(&m_Input, sizeof(m_Input));
+		m_Input.m_PlayerFlags = PLAYERFLAG_PLAYING;
+		m_Input.m_TargetX = 100;
+		m_Angle = 0.0f;
+		m_NextMove = 0;
+	}
+
+	// walks, jumps, hooks and fires around with random durations
+	const CNetObj_PlayerInput &NextInput(int Tick)
+	{
+		if(Tick >= m_NextMove)
+		{
+			m_Input.m_Direction = Range(-1, 1);
+			m_Input.m_WantedWeapon = Chance(20) ? Range(1, NUM_WEAPONS) : 0;
+			m_NextMove = Tick + Range(SERVER_TICK_SPEED / 5, SERVER_TICK_SPEED * 2);
+		}
+
+		m_Input.m_Jump = Chance(4);
+		if(Chance(3))
+			m_Input.m_Hook ^= 1;
+		// the fire counter is increased on every press and every release
+		if(Chance(10))
+			m_Input.m_Fire++;
+
+		m_Angle += Range(-10, 10) * pi / 180.0f;
+		m_Input.m_TargetX = (int)(cosf(m_Angle) * 200.0f);
+		m_Input.m_TargetY = (int)(sinf(m_Angle) * 200.0f);
+		return m_Input;
+	}
+};
+
+// over the clients which received snapshots
+static void PrintSnapshotStats(const CServer *pServer, int NumTicks)
+{
+	int64_t TotalBytes = 0;
+	int TotalSnapshots = 0;
+	int NumClients = 0;
+	int64_t MinBytes = -1;
+	int64_t MaxBytes = 0;
+	for(int i = 0; i < MAX_CLIENTS; i++)
+	{
+		if(!pServer->m_aHeadlessSnapshots[i])
+			continue;
+		NumClients++;
+		TotalBytes += pServer->m_aHeadlessSnapshotBytes[i];
+		TotalSnapshots += pServer->m_aHeadlessSnapshots[i];
+		if(MinBytes < 0 || pServer->m_aHeadlessSnapshotBytes[i] < MinBytes)
+			MinBytes = pServer->m_aHeadlessSnapshotBytes[i];
+		MaxBytes = maximum(MaxBytes, pServer->m_aHeadlessSnapshotBytes[i]);
+	}
+	if(!NumClients)
+		return;
+
+	const double GameSeconds = NumTicks / (double)SERVER_TICK_SPEED;
+	dbg_msg(TOOL_NAME, "snapshots: %.1f bytes per snapshot, %.2f KiB/s per client (min %.2f, max %.2f)",
+		TotalBytes / (double)TotalSnapshots, TotalBytes / 1024.0 / NumClients / GameSeconds,
+		MinBytes / 1024.0 / GameSeconds, MaxBytes / 1024.0 / GameSeconds);
+}
+
+static void Usage()
+{
+	dbg_msg(TOOL_NAME, "Usage: %s [-t ticks] [-b bots] [-s seed] [-r trace] [console commands]", TOOL_NAME);
+	dbg_msg(TOOL_NAME, "The map is set with the console, e.g. %s -t 3000 \"sv_map infc_skull\"", TOOL_NAME);
+	dbg_msg(TOOL_NAME, "A trace is replayed completely unless -t is given");
+}
+
+int main(int argc, const char **argv)
+{
+	CCmdlineFix CmdlineFix(&argc, &argv);
+	log_set_global_logger_default();
+
+	int NumTicks = 3000;
+	int NumBots = MAX_CLIENTS;
+	unsigned Seed = 1;
+	const char *pTraceFilename = nullptr;
+	bool TicksGiven = false;
+
+	int FirstConsoleArg = 1;
+	while(FirstConsoleArg + 1 < argc && argv[FirstConsoleArg][0] == '-')
+	{
+		const char *pOption = argv[FirstConsoleArg];
+		const char *pValue = argv[FirstConsoleArg + 1];
+		if(str_comp(pOption, "-t") == 0)
+		{
+			NumTicks = str_toint(pValue);
+			TicksGiven = true;
+		}
+		else if(str_comp(pOption, "-b") == 0)
+			NumBots = str_toint(pValue);
+		else if(str_comp(pOption, "-s") == 0)
+			Seed = str_toint(pValue);
+		else if(str_comp(pOption, "-r") == 0)
+			pTraceFilename = pValue;
+		else
+		{
+			Usage();
+			return -1;
+		}
+		FirstConsoleArg += 2;
+	}
+	if(NumTicks <= 0 || NumBots <= 0 || NumBots > MAX_CLIENTS)
+	{
+		Usage();
+		return -1;
+	}
+
+	if(secure_random_init() != 0)
+	{
+		dbg_msg("secure", "could not initialize secure RNG");
+		return -1;
+	}
+
+	CServer *pServer = CreateServer();
+	IKernel *pKernel = IKernel::Create();
+	pKernel->RegisterInterface(pServer);
+
+	IEngine *pEngine = CreateEngine(GAME_NAME, nullptr, 2 * std::thread::hardware_concurrency() + 2);
+	pKernel->RegisterInterface(pEngine);
+
+	IStorage *pStorage = CreateStorage(IStorage::STORAGETYPE_SERVER, argc, argv);
+	pKernel->RegisterInterface(pStorage);
+
+	IConsole *pConsole = CreateConsole(CFGFLAG_SERVER).release();
+	pKernel->RegisterInterface(pConsole);
+
+	IConfigManager *pConfigManager = CreateConfigManager();
+	pKernel->RegisterInterface(pConfigManager);
+
+	IEngineMap *pEngineMap = CreateEngineMap();
+	pKernel->RegisterInterface(pEngineMap);
+	pKernel->RegisterInterface(static_cast<IMap *>(pEngineMap), false);
+
+	IGameServer *pGameServer = CreateGameServer();
+	pKernel->RegisterInterface(pGameServer);
+
+	pServer->m_pLocalization = new CLocalization(pStorage);
+	pServer->m_pLocalization->InitConfig(0, NULL);
+	if(!pServer->m_pLocalization->Init())
+	{
+		dbg_msg("localization", "could not initialize localization");
+		return -1;
+	}
+
+	pEngine->Init();
+	pConfigManager->Init();
+	pConsole->Init();
+	pServer->RegisterCommands();
+
+	// no autoexec, the runs only depend on the command line
+	if(FirstConsoleArg < argc)
+		pConsole->ParseArguments(argc - FirstConsoleArg, &argv[FirstConsoleArg]);
+
+	CInputTraceReader Trace;
+	if(pTraceFilename)
+	{
+		if(!Trace.Open(pStorage, pTraceFilename, IStorage::TYPE_ALL_OR_ABSOLUTE))
+		{
+			dbg_msg(TOOL_NAME, "failed to open the input trace '%s'", pTraceFilename);
+			return -1;
+		}
+		str_copy(g_Config.m_SvMap, Trace.MapName());
+		Seed = Trace.Seed();
+		if(!TicksGiven)
+			NumTicks = MAX_TICK;
+	}
+
+	if(!g_Config.m_SvMap[0])
+	{
+		Usage();
+		return -1;
+	}
+	random_seed(Seed);
+	if(pServer->StartHeadless() != 0)
+		return -1;
+
+	if(pTraceFilename)
+	{
+		if(Trace.MapCrc() != pEngineMap->Crc())
+			dbg_msg(TOOL_NAME, "the map '%s' differs from the one of the trace, the game will not be the same", Trace.MapName());
+
+		pServer->m_Profiler.Reset();
+		const int64_t StartTime = time_get_impl();
+		NumTicks = pServer->ReplayInputTrace(&Trace, NumTicks);
+		const double Seconds = (time_get_impl() - StartTime) / (double)time_freq();
+
+		dbg_msg(TOOL_NAME, "replayed %d ticks of '%s' on '%s' in %.2fs, %.1f ticks/s (%.3fms per tick)",
+			NumTicks, pTraceFilename, g_Config.m_SvMap, Seconds, NumTicks / Seconds, Seconds * 1000.0 / maximum(NumTicks, 1));
+		pConsole->ExecuteLine("perf_dump");
+		PrintSnapshotStats(pServer, NumTicks);
+
+		delete pServer->m_pLocalization;
+		delete pKernel;
+		return 0;
+	}
+
+	NumBots = minimum(NumBots, pServer->MaxClients());
+
+	std::vector<CBenchBot> vBots;
+	for(int i = 0; i < NumBots; i++)
+	{
+		char aName[MAX_NAME_LENGTH];
+		str_format(aName, sizeof(aName), "bench %d", i);
+		pServer->NewBot(i);
+		pServer->SetClientName(i, aName);
+		pGameServer->OnClientConnected(i, nullptr);
+		pGameServer->OnClientEnter(i);
+		vBots.emplace_back(Seed * MAX_CLIENTS + i);
+	}
+
+	// every human and infected class in turn
+	for(int i = 0; i < NumBots; i++)
+	{
+		const EPlayerClass Class = static_cast<EPlayerClass>(1 + i % (NB_PLAYERCLASS - 1));
+		char aBuf[128];
+		str_format(aBuf, sizeof(aBuf), "inf_set_class %d %s", i, CInfClassGameController::GetClassName(Class));
+		pConsole->ExecuteLine(aBuf);
+	}
+
+	pServer->m_Profiler.Reset();
+	const int64_t StartTime = time_get_impl();
+	for(int t = 0; t < NumTicks; t++)
+	{
+		for(int i = 0; i < NumBots; i++)
+		{
+			const CNetObj_PlayerInput &Input = vBots[i].NextInput(pServer->Tick());
+			pServer->AddClientInput(i, pServer->Tick() + 1, (const int *)&Input, sizeof(Input) / sizeof(int));
+		}
+		pServer->TickHeadless();
+	}
+	const double Seconds = (time_get_impl() - StartTime) / (double)time_freq();
+
+	dbg_msg(TOOL_NAME, "%d ticks with %d bots on '%s' in %.2fs, %.1f ticks/s (%.3fms per tick)",
+		NumTicks, NumBots, g_Config.m_SvMap, Seconds, NumTicks / Seconds, Seconds * 1000.0 / NumTicks);
+	pConsole->ExecuteLine("perf_dump");
+	PrintSnapshotStats(pServer, NumTicks);
+
+	delete pServer->m_pLocalization;
+	delete pKernel;
+
+	return 0;
+}